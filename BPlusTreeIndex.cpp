@@ -0,0 +1,299 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: BPlusTreeIndex.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the on-disk B+tree index.
+
+        Data Structure: page 0 holds the header; every other page is one node
+                        {leaf flag, count, link, entries[255] of {key[12], value}}
+        Algorithm: binary search within a node, descend one page per level;
+                   a full node splits in half and pushes its separator up,
+                   growing a new root when the old root splits; leaves are
+                   linked so range scans walk them left to right;
+                   every page access is one pread/pwrite at its own offset
+*/
+
+//============================================
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "BPlusTreeIndex.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr uint32_t TREE_MAGIC = 0x45455242;  // "BREE"
+static constexpr uint32_t TREE_VERSION = 1;
+static constexpr uint32_t MAX_DEPTH = 16;          // 255-way fanout: far beyond any file we index
+
+//-----------------------------------------------
+// helper: zero-padded copy of a key, so memcmp orders keys like strcmp
+static void normalizeKey(const char *key, char out[BPLUS_TREE_KEY_LEN + 1])
+{
+    memset(out, 0, BPLUS_TREE_KEY_LEN + 1);
+    strncpy(out, key, BPLUS_TREE_KEY_LEN);
+}
+
+//-----------------------------------------------
+// helper: number of entries whose key is < key (lower bound) or <= key
+// (upper bound) in a node's sorted entry array
+template <typename EntryT>
+static uint32_t boundIn(const EntryT *entries, uint32_t count, const char *key, bool upper)
+{
+    uint32_t lo = 0, hi = count;
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2;
+        int cmp = memcmp(entries[mid].key, key, BPLUS_TREE_KEY_LEN + 1);
+        if (cmp < 0 || (upper && cmp == 0)) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+//-----------------------------------------------
+bool BPlusTreeIndex::open(const string &path, uint64_t dataFileSize)
+{
+    filePath = path;
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);  // Index missing: created empty
+    if (fd < 0)
+    {
+        cerr << "Error: Failed to create index file " << path << "." << endl;
+        return false;
+    }
+
+    if (pread(fd, &header, sizeof(Header), 0) != static_cast<ssize_t>(sizeof(Header)))
+    {
+        return false;  // Empty or truncated index
+    }
+
+    bool usable = header.magic == TREE_MAGIC &&
+                  header.version == TREE_VERSION &&
+                  header.pageSize == BPLUS_TREE_PAGE_SIZE &&
+                  header.clean == 1 &&
+                  header.dataFileSize == dataFileSize;
+    if (!usable) return false;
+
+    // Mark the index as in use so a crash before close() forces a rebuild
+    header.clean = 0;
+    return writeHeader();
+}
+
+//-----------------------------------------------
+void BPlusTreeIndex::close(uint64_t dataFileSize)
+{
+    if (fd < 0) return;
+    header.clean = 1;
+    header.dataFileSize = dataFileSize;
+    writeHeader();
+    ::close(fd);
+    fd = -1;
+}
+
+//-----------------------------------------------
+bool BPlusTreeIndex::rebuild()
+{
+    if (fd < 0) return false;
+
+    header = Header{};
+    header.magic = TREE_MAGIC;
+    header.version = TREE_VERSION;
+    header.pageSize = BPLUS_TREE_PAGE_SIZE;
+    header.rootPage = 1;
+    header.pageCount = 2;
+
+    // Rewrite the file as the header page followed by one empty root leaf
+    if (ftruncate(fd, 0) != 0) return false;
+
+    Node root{};
+    root.leaf = 1;
+    return writeNode(header.rootPage, root) && writeHeader();
+}
+
+//-----------------------------------------------
+bool BPlusTreeIndex::find(const char *key, uint32_t &slot) const
+{
+    if (fd < 0 || header.rootPage == 0) return false;
+
+    char k[BPLUS_TREE_KEY_LEN + 1];
+    normalizeKey(key, k);
+    uint32_t path[MAX_DEPTH];
+    uint32_t depth;
+    uint32_t page = findLeaf(k, path, depth);
+    if (page == 0) return false;
+
+    Node leaf;
+    if (!readNode(page, leaf)) return false;
+    uint32_t pos = boundIn(leaf.entries, leaf.count, k, false);
+    if (pos == leaf.count || memcmp(leaf.entries[pos].key, k, sizeof(k)) != 0) return false;
+    slot = leaf.entries[pos].value;
+    return true;
+}
+
+//-----------------------------------------------
+bool BPlusTreeIndex::insert(const char *key, uint32_t slot)
+{
+    if (fd < 0 || header.rootPage == 0) return false;
+
+    Entry pending{};
+    normalizeKey(key, pending.key);
+    pending.value = slot;
+
+    uint32_t path[MAX_DEPTH];
+    uint32_t depth;
+    uint32_t page = findLeaf(pending.key, path, depth);
+    if (page == 0) return false;
+
+    Node node;
+    if (!readNode(page, node)) return false;
+    uint32_t pos = boundIn(node.entries, node.count, pending.key, false);
+    if (pos < node.count && memcmp(node.entries[pos].key, pending.key, sizeof(pending.key)) == 0)
+    {
+        return true;  // Keep the first record for a duplicate key
+    }
+    header.entryCount++;
+
+    // Loop goal: place pending in node; while node overflows, split it and
+    // carry the separator (pending) up to the parent
+    while (true)
+    {
+        if (!node.leaf) pos = boundIn(node.entries, node.count, pending.key, true);
+
+        if (node.count < MAX_ENTRIES)
+        {
+            memmove(&node.entries[pos + 1], &node.entries[pos], (node.count - pos) * sizeof(Entry));
+            node.entries[pos] = pending;
+            node.count++;
+            return writeNode(page, node) && writeHeader();
+        }
+
+        // Full: merge in the new entry, then split the MAX_ENTRIES + 1 entries
+        vector<Entry> all(node.entries, node.entries + node.count);
+        all.insert(all.begin() + pos, pending);
+
+        Node right{};
+        right.leaf = node.leaf;
+        uint32_t rightPage = header.pageCount++;
+        uint32_t half = static_cast<uint32_t>(all.size()) / 2;
+
+        if (node.leaf)
+        {
+            // Leaves keep every entry; the right half's first key is copied up
+            node.count = static_cast<uint16_t>(half);
+            right.count = static_cast<uint16_t>(all.size() - half);
+            memcpy(node.entries, all.data(), half * sizeof(Entry));
+            memcpy(right.entries, all.data() + half, right.count * sizeof(Entry));
+            right.link = node.link;
+            node.link = rightPage;
+            pending = right.entries[0];
+        }
+        else
+        {
+            // Inner nodes move the middle key up; its child becomes the
+            // right node's leftmost child
+            node.count = static_cast<uint16_t>(half);
+            right.count = static_cast<uint16_t>(all.size() - half - 1);
+            memcpy(node.entries, all.data(), half * sizeof(Entry));
+            memcpy(right.entries, all.data() + half + 1, right.count * sizeof(Entry));
+            right.link = all[half].value;
+            pending = all[half];
+        }
+        pending.value = rightPage;
+        if (!writeNode(page, node) || !writeNode(rightPage, right)) return false;
+
+        if (depth == 0)  // Root split: the tree grows one level
+        {
+            Node root{};
+            root.leaf = 0;
+            root.count = 1;
+            root.link = page;
+            root.entries[0] = pending;
+            header.rootPage = header.pageCount++;
+            return writeNode(header.rootPage, root) && writeHeader();
+        }
+
+        page = path[--depth];
+        if (!readNode(page, node)) return false;
+    }
+}
+
+//-----------------------------------------------
+bool BPlusTreeIndex::scan(const char *fromKey, const function<bool(const char*, uint32_t)> &visit) const
+{
+    if (fd < 0 || header.rootPage == 0) return false;
+
+    char k[BPLUS_TREE_KEY_LEN + 1];
+    normalizeKey(fromKey, k);
+    uint32_t path[MAX_DEPTH];
+    uint32_t depth;
+    uint32_t page = findLeaf(k, path, depth);
+
+    Node leaf;
+    uint32_t pos = 0;
+    bool first = true;
+    // Loop goal: walk the leaf chain from the lower bound of fromKey
+    while (page != 0)
+    {
+        if (!readNode(page, leaf)) return false;
+        if (first) pos = boundIn(leaf.entries, leaf.count, k, false);
+        first = false;
+
+        for (; pos < leaf.count; ++pos)
+        {
+            if (!visit(leaf.entries[pos].key, leaf.entries[pos].value)) return true;
+        }
+        page = leaf.link;
+        pos = 0;
+    }
+    return true;
+}
+
+//-----------------------------------------------
+// Descends from the root to the leaf that would hold key, recording the
+// inner pages passed in path[0..depth). Returns the leaf page, 0 on error.
+uint32_t BPlusTreeIndex::findLeaf(const char *key, uint32_t *path, uint32_t &depth) const
+{
+    depth = 0;
+    uint32_t page = header.rootPage;
+    Node node;
+    while (true)
+    {
+        if (!readNode(page, node)) return 0;
+        if (node.leaf) return page;
+        if (depth == MAX_DEPTH) return 0;  // Corrupt: a cycle or absurd height
+
+        path[depth++] = page;
+        uint32_t pos = boundIn(node.entries, node.count, key, true);
+        page = pos == 0 ? node.link : node.entries[pos - 1].value;
+    }
+}
+
+//-----------------------------------------------
+bool BPlusTreeIndex::readNode(uint32_t page, Node &n) const
+{
+    if (page == 0 || page >= header.pageCount) return false;
+    off_t offset = static_cast<off_t>(page) * BPLUS_TREE_PAGE_SIZE;
+    return pread(fd, &n, sizeof(Node), offset) == static_cast<ssize_t>(sizeof(Node));
+}
+
+//-----------------------------------------------
+bool BPlusTreeIndex::writeNode(uint32_t page, const Node &n)
+{
+    // Write the full page so the file stays a whole number of pages
+    char buffer[BPLUS_TREE_PAGE_SIZE] = {};
+    memcpy(buffer, &n, sizeof(Node));
+    off_t offset = static_cast<off_t>(page) * BPLUS_TREE_PAGE_SIZE;
+    return pwrite(fd, buffer, sizeof(buffer), offset) == static_cast<ssize_t>(sizeof(buffer));
+}
+
+//-----------------------------------------------
+bool BPlusTreeIndex::writeHeader()
+{
+    return pwrite(fd, &header, sizeof(Header), 0) == static_cast<ssize_t>(sizeof(Header));
+}
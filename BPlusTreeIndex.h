@@ -0,0 +1,126 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: BPlusTreeIndex.h
+/*
+    Module: BPlusTreeIndex.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of an on-disk B+tree index that maps a short fixed-width
+        string key (e.g. a vehicle license plate) to the slot number of a
+        record in a fixed-length binary data file. Keys are kept in order,
+        so besides point lookups the index supports range and prefix scans.
+*/
+
+#ifndef BPLUS_TREE_INDEX_H
+#define BPLUS_TREE_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+//-----------------------------------------------
+// Constants
+static constexpr std::size_t BPLUS_TREE_KEY_LEN = 11;     // significant key bytes (Vehicle::licensePlate)
+static constexpr std::size_t BPLUS_TREE_PAGE_SIZE = 4096; // one node per page
+
+//-----------------------------------------------
+// Class:   BPlusTreeIndex
+// Purpose: B+tree stored in its own file, one node per page. Leaves hold
+//          {key, slot} entries and are chained left to right for scans.
+//          A lookup reads one page per level. As with HashIndex, the header
+//          remembers the size of the data file it was built against so a
+//          stale index is detected when the storage module opens it.
+//          Pages are read and written positionally (pread/pwrite, no shared
+//          file cursor), so find() and scan() may run on several threads at
+//          once; insert needs the caller's exclusive lock.
+class BPlusTreeIndex
+{
+public:
+    //-----------------------------------------------
+    bool open(
+        const std::string &path,     // in: index file path
+        std::uint64_t dataFileSize   // in: current size of the indexed data file
+    );
+    // Opens (or creates) the index file.
+    // Returns true if the existing index is usable; false if it is missing,
+    // corrupt, was not shut down cleanly, or was built for a different data
+    // file size. On false the caller must call rebuild() and re-insert.
+
+    //-----------------------------------------------
+    void close(
+        std::uint64_t dataFileSize   // in: final size of the indexed data file
+    );
+    // Marks the index clean, records the data file size and closes the file.
+
+    //-----------------------------------------------
+    bool rebuild();
+    // Discards every entry, leaving a tree with one empty leaf.
+
+    //-----------------------------------------------
+    bool find(
+        const char *key,             // in: key to look up
+        std::uint32_t &slot          // out: record slot if found
+    ) const;
+    // Returns true and sets slot if key is present.
+
+    //-----------------------------------------------
+    bool insert(
+        const char *key,             // in: key to add
+        std::uint32_t slot           // in: record slot of key
+    );
+    // Adds key -> slot. If key is already present the existing entry is kept.
+    // Splits full nodes on the way back up.
+
+    //-----------------------------------------------
+    bool scan(
+        const char *fromKey,                                          // in: first key of interest
+        const std::function<bool(const char*, std::uint32_t)> &visit  // in: called per entry; return false to stop
+    ) const;
+    // Visits every entry with key >= fromKey in ascending key order.
+
+    //-----------------------------------------------
+    bool isOpen() const { return fd >= 0; }
+
+private:
+    struct Header
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t pageSize;
+        std::uint32_t rootPage;
+        std::uint32_t pageCount;     // pages in the file, header page included
+        std::uint32_t entryCount;    // keys in the leaves
+        std::uint32_t clean;         // 1 if closed cleanly, 0 while open
+        std::uint32_t reserved;
+        std::uint64_t dataFileSize;  // size of data file the index describes
+    };
+
+    struct Entry
+    {
+        char key[BPLUS_TREE_KEY_LEN + 1];  // zero-padded
+        std::uint32_t value;               // leaf: record slot; inner: child page right of key
+    };
+
+    static constexpr std::uint32_t MAX_ENTRIES = (BPLUS_TREE_PAGE_SIZE - 8) / sizeof(Entry);
+
+    struct Node
+    {
+        std::uint16_t leaf;          // 1 for a leaf
+        std::uint16_t count;         // entries in use
+        std::uint32_t link;          // leaf: next leaf page (0 = none); inner: leftmost child
+        Entry entries[MAX_ENTRIES];
+    };
+    static_assert(sizeof(Node) <= BPLUS_TREE_PAGE_SIZE, "a node must fit in one page");
+
+    std::uint32_t findLeaf(const char *key, std::uint32_t *path, std::uint32_t &depth) const;
+    bool readNode(std::uint32_t page, Node &n) const;
+    bool writeNode(std::uint32_t page, const Node &n);
+    bool writeHeader();
+
+    int fd = -1;
+    std::string filePath;
+    Header header{};
+};
+
+#endif // BPLUS_TREE_INDEX_H
@@ -0,0 +1,80 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: BackgroundTasks.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the background maintenance worker.
+
+        Data Structure: FIFO queue of named tasks guarded by a mutex
+        Algorithm: one worker thread waits on a condition variable and runs
+                   tasks in order; duplicate names are coalesced while queued
+*/
+
+//============================================
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "BackgroundTasks.h"
+
+using namespace std;
+
+//============================================
+
+static mutex taskMutex;                                 // guards the queue and worker state
+static condition_variable taskReady;
+static deque<pair<string, function<void()>>> taskQueue;
+static thread worker;
+static bool stopping = false;
+
+//-----------------------------------------------
+// helper: worker loop, runs until stopping is set and the queue is empty
+static void workerLoop()
+{
+    unique_lock<mutex> lock(taskMutex);
+    while (true)
+    {
+        taskReady.wait(lock, []() { return stopping || !taskQueue.empty(); });
+        if (taskQueue.empty()) break;  // stopping with nothing left to do
+
+        auto task = move(taskQueue.front().second);
+        taskQueue.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+//-----------------------------------------------
+void scheduleBackgroundTask(const string &name, function<void()> task)
+{
+    lock_guard<mutex> lock(taskMutex);
+    for (const auto &queued : taskQueue)
+    {
+        if (queued.first == name) return;  // Already waiting to run
+    }
+    taskQueue.emplace_back(name, move(task));
+
+    if (!worker.joinable())
+    {
+        stopping = false;
+        worker = thread(workerLoop);
+    }
+    taskReady.notify_one();
+}
+
+//-----------------------------------------------
+void stopBackgroundTasks()
+{
+    {
+        lock_guard<mutex> lock(taskMutex);
+        if (!worker.joinable()) return;
+        stopping = true;
+    }
+    taskReady.notify_one();
+    worker.join();
+    worker = thread();
+}
@@ -0,0 +1,31 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: BackgroundTasks.h
+/*
+    Module: BackgroundTasks.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of a single background worker used for storage
+        maintenance (e.g. compacting data files) off the clerk's path.
+*/
+
+#ifndef BACKGROUND_TASKS_H
+#define BACKGROUND_TASKS_H
+
+#include <functional>
+#include <string>
+
+//-----------------------------------------------
+void scheduleBackgroundTask(
+    const std::string &name,     // in: task name; a task already queued under this name is not queued twice
+    std::function<void()> task   // in: work to run on the background thread
+);
+// Queues a task, starting the worker thread on first use.
+// The task must take whatever locks its module needs.
+
+//-----------------------------------------------
+void stopBackgroundTasks();
+// Runs every queued task to completion and joins the worker thread.
+// Called before storage modules shut down.
+
+#endif // BACKGROUND_TASKS_H
@@ -0,0 +1,465 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: BatchCommandProcessor.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the headless command mode. Each line is split
+        into fields, checked the way the menu screens check their input,
+        turned into one protocol request and sent through the ferry client
+        (in-process or to a server). Nothing is prompted and no colour codes
+        are written; results go out through one buffered stream.
+*/
+
+//============================================
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "BatchCommandProcessor.h"
+#include "FerryClient.h"
+#include "Units.h"
+
+using namespace std;
+
+//============================================
+
+static const uint32_t REPORT_BATCH_ROWS = 4096;  // sailings fetched per report request
+
+using Arguments = vector<string>;
+
+//-----------------------------------------------
+// Struct:  BatchContext
+// Purpose: Where the command being run writes its results.
+struct BatchContext
+{
+    unsigned long line;     // input line number of the command
+    ostream &out;
+    bool failed;            // the command wrote a result line other than OK
+};
+
+//-----------------------------------------------
+// helper: write one result line
+static void writeResult(BatchContext &context, FerryStatus status, const char *fields = "")
+{
+    context.out << context.line << '\t' << ferryStatusName(status);
+    if (fields[0] != '\0') context.out << '\t' << fields;
+    context.out << '\n';
+
+    if (status != FerryStatus::OK) context.failed = true;
+}
+
+//-----------------------------------------------
+// helper: result line for a command that was not sent
+static void writeError(BatchContext &context, const char *message)
+{
+    string fields = string("error=") + message;
+    writeResult(context, FerryStatus::BAD_REQUEST, fields.c_str());
+}
+
+//-----------------------------------------------
+// helper: split a line into blank-separated fields; "double quotes" keep
+// blanks inside a field. Returns false on an unterminated quote.
+static bool splitFields(const string &line, Arguments &fields)
+{
+    fields.clear();
+    size_t i = 0;
+    while (i < line.size())
+    {
+        while (i < line.size() && isspace(static_cast<unsigned char>(line[i]))) ++i;
+        if (i == line.size()) break;
+
+        string field;
+        if (line[i] == '"')
+        {
+            size_t close = line.find('"', i + 1);
+            if (close == string::npos) return false;
+            field = line.substr(i + 1, close - i - 1);
+            i = close + 1;
+        }
+        else
+        {
+            size_t end = i;
+            while (end < line.size() && !isspace(static_cast<unsigned char>(line[end]))) ++end;
+            field = line.substr(i, end - i);
+            i = end;
+        }
+        fields.push_back(field);
+    }
+    return true;
+}
+
+//-----------------------------------------------
+// helper: true if text fits a char[size] field (with its null)
+static bool fitsField(const string &text, size_t size)
+{
+    return !text.empty() && text.size() < size;
+}
+
+//-----------------------------------------------
+// helper: XXX-DD-HH, as the sailing screens accept it
+static bool isSailingIDFormat(const string &id)
+{
+    return id.size() == 9 && id[3] == '-' && id[6] == '-' &&
+           isdigit(static_cast<unsigned char>(id[4])) && isdigit(static_cast<unsigned char>(id[5])) &&
+           isdigit(static_cast<unsigned char>(id[7])) && isdigit(static_cast<unsigned char>(id[8]));
+}
+
+//-----------------------------------------------
+// helper: whole-field decimal number within [low, high]
+static bool parseNumber(const string &text, double low, double high, double &value)
+{
+    char *end = nullptr;
+    value = strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && value >= low && value <= high;
+}
+
+//-----------------------------------------------
+// helper: plate and sailing ID of a reservation command
+static bool readReservationKey(BatchContext &context, const Arguments &args, ReservationKeyRequest &request)
+{
+    if (!fitsField(args[0], sizeof(request.licensePlate)))
+    {
+        writeError(context, "plate must be 1-10 characters");
+        return false;
+    }
+    if (!isSailingIDFormat(args[1]))
+    {
+        writeError(context, "sailing ID must be XXX-DD-HH");
+        return false;
+    }
+    copyKey(request.licensePlate, sizeof(request.licensePlate), args[0].c_str());
+    copyKey(request.sailingID, sizeof(request.sailingID), args[1].c_str());
+    return true;
+}
+
+//-----------------------------------------------
+// helper: report fields of one sailing
+static void writeSailingRow(BatchContext &context, const SailingRow &row)
+{
+    char fields[160];
+    snprintf(fields, sizeof(fields), "sailing=%s\tvessel=%s\tlrl=%.1f\thrl=%.1f\ttv=%d\tcf=%.1f",
+             row.sailing.id, row.sailing.vesselName, toMetres(row.sailing.LRL), toMetres(row.sailing.HRL),
+             row.vehicleCount, row.capacityFactor);
+    writeResult(context, FerryStatus::OK, fields);
+}
+
+//-----------------------------------------------
+// vessel NAME LOWCAP HIGHCAP
+static void runVessel(BatchContext &context, const Arguments &args)
+{
+    Vessel vessel{};
+    double low, high;
+    if (!fitsField(args[0], sizeof(vessel.name)))
+    {
+        return writeError(context, "vessel name must be 1-25 characters");
+    }
+    if (!parseNumber(args[1], 0, 3600, low) || !parseNumber(args[2], 0, 3600, high) ||
+        low != static_cast<int>(low) || high != static_cast<int>(high))
+    {
+        return writeError(context, "lane capacities must be whole numbers 0-3600");
+    }
+    copyKey(vessel.name, sizeof(vessel.name), args[0].c_str());
+    vessel.lowCap = toCentimetres(low);
+    vessel.highCap = toCentimetres(high);
+    writeResult(context, callFerry(FerryOp::VESSEL_CREATE, vessel));
+}
+
+//-----------------------------------------------
+// sailing VESSEL SAILING_ID
+static void runSailing(BatchContext &context, const Arguments &args)
+{
+    SailingCreateRequest request;
+    if (!fitsField(args[0], sizeof(request.vesselName)))
+    {
+        return writeError(context, "vessel name must be 1-25 characters");
+    }
+    if (!isSailingIDFormat(args[1]))
+    {
+        return writeError(context, "sailing ID must be XXX-DD-HH");
+    }
+    copyKey(request.vesselName, sizeof(request.vesselName), args[0].c_str());
+    copyKey(request.sailingID, sizeof(request.sailingID), args[1].c_str());
+    writeResult(context, callFerry(FerryOp::SAILING_CREATE, request));
+}
+
+//-----------------------------------------------
+// delete-sailing SAILING_ID
+static void runDeleteSailing(BatchContext &context, const Arguments &args)
+{
+    if (!isSailingIDFormat(args[0]))
+    {
+        return writeError(context, "sailing ID must be XXX-DD-HH");
+    }
+    writeResult(context, callFerry(FerryOp::SAILING_DELETE, makeKeyRequest(args[0].c_str())));
+}
+
+//-----------------------------------------------
+// reserve PLATE SAILING_ID [LENGTH HEIGHT PHONE]
+static void runReserve(BatchContext &context, const Arguments &args)
+{
+    ReservationKeyRequest key;
+    if (!readReservationKey(context, args, key)) return;
+
+    ReservationCreateRequest request{};
+    copyKey(request.licensePlate, sizeof(request.licensePlate), key.licensePlate);
+    copyKey(request.sailingID, sizeof(request.sailingID), key.sailingID);
+    request.registered = args.size() == 2;
+    if (!request.registered)
+    {
+        double length, height;
+        if (args.size() != 5)
+        {
+            return writeError(context, "new vehicles need LENGTH HEIGHT PHONE");
+        }
+        if (!parseNumber(args[2], 0.0, 99.9, length))
+        {
+            return writeError(context, "vehicle length must be between 0.0 and 99.9");
+        }
+        if (!parseNumber(args[3], 0.0, 9.9, height))
+        {
+            return writeError(context, "vehicle height must be between 0.0 and 9.9");
+        }
+        if (!fitsField(args[4], sizeof(request.phone)))
+        {
+            return writeError(context, "phone must be 1-14 characters");
+        }
+        request.vehicleLength = toCentimetres(length);
+        request.vehicleHeight = toCentimetres(height);
+        copyKey(request.phone, sizeof(request.phone), args[4].c_str());
+    }
+
+    ReservationCreateResponse result;
+    FerryStatus status = callFerry(FerryOp::RESERVATION_CREATE, request, result);
+    if (status != FerryStatus::OK) return writeResult(context, status);
+
+    char fields[48];
+    snprintf(fields, sizeof(fields), "lane=%s%s", result.lane == Lane::LOW ? "LOW" : "HIGH",
+             request.registered ? "" : (result.vehicleSaved ? "\tvehicle=saved" : "\tvehicle=not-saved"));
+    writeResult(context, status, fields);
+}
+
+//-----------------------------------------------
+// cancel PLATE SAILING_ID
+static void runCancel(BatchContext &context, const Arguments &args)
+{
+    ReservationKeyRequest request;
+    if (!readReservationKey(context, args, request)) return;
+    writeResult(context, callFerry(FerryOp::RESERVATION_CANCEL, request));
+}
+
+//-----------------------------------------------
+// checkin PLATE SAILING_ID
+static void runCheckIn(BatchContext &context, const Arguments &args)
+{
+    ReservationKeyRequest request;
+    if (!readReservationKey(context, args, request)) return;
+
+    CheckInResponse result;
+    FerryStatus status = callFerry(FerryOp::RESERVATION_CHECK_IN, request, result);
+    if (status != FerryStatus::OK) return writeResult(context, status);
+
+    char fields[32];
+    snprintf(fields, sizeof(fields), "fare=%.2f", result.fare);
+    writeResult(context, status, fields);
+}
+
+//-----------------------------------------------
+// checkin-batch SAILING_ID PLATE [PLATE...]
+static void runCheckInBatch(BatchContext &context, const Arguments &args)
+{
+    const size_t PLATE_SIZE = sizeof(Reservation::licensePlate);
+    if (!isSailingIDFormat(args[0]))
+    {
+        return writeError(context, "sailing ID must be XXX-DD-HH");
+    }
+
+    BatchCheckInHeader header{};
+    copyKey(header.sailingID, sizeof(header.sailingID), args[0].c_str());
+    header.count = static_cast<uint32_t>(args.size() - 1);
+
+    vector<char> request(sizeof(header) + header.count * PLATE_SIZE, 0);
+    memcpy(request.data(), &header, sizeof(header));
+    for (size_t i = 1; i < args.size(); ++i)
+    {
+        if (!fitsField(args[i], PLATE_SIZE))
+        {
+            return writeError(context, "plate must be 1-10 characters");
+        }
+        copyKey(request.data() + sizeof(header) + (i - 1) * PLATE_SIZE, PLATE_SIZE, args[i].c_str());
+    }
+
+    vector<char> response;
+    FerryStatus status = callFerry(FerryOp::RESERVATION_CHECK_IN_BATCH, request.data(), request.size(), response);
+    if (status == FerryStatus::OK && response.size() != header.count * sizeof(BatchCheckInResult))
+    {
+        status = FerryStatus::BAD_REQUEST;
+    }
+    if (status != FerryStatus::OK) return writeResult(context, status);
+
+    for (uint32_t i = 0; i < header.count; ++i)
+    {
+        BatchCheckInResult result;
+        memcpy(&result, response.data() + i * sizeof(result), sizeof(result));
+
+        char fields[48];
+        FerryStatus plateStatus = static_cast<FerryStatus>(result.status);
+        if (plateStatus == FerryStatus::OK)
+            snprintf(fields, sizeof(fields), "plate=%s\tfare=%.2f", args[i + 1].c_str(), result.fare);
+        else
+            snprintf(fields, sizeof(fields), "plate=%s", args[i + 1].c_str());
+        writeResult(context, plateStatus, fields);
+    }
+}
+
+//-----------------------------------------------
+// prepare SAILING_ID
+static void runPrepare(BatchContext &context, const Arguments &args)
+{
+    if (!isSailingIDFormat(args[0]))
+    {
+        return writeError(context, "sailing ID must be XXX-DD-HH");
+    }
+
+    PrepareSailingResponse result;
+    FerryStatus status = callFerry(FerryOp::SAILING_PREPARE, makeKeyRequest(args[0].c_str()), result);
+    if (status != FerryStatus::OK) return writeResult(context, status);
+
+    char fields[32];
+    snprintf(fields, sizeof(fields), "reservations=%u", static_cast<unsigned>(result.reservations));
+    writeResult(context, status, fields);
+}
+
+//-----------------------------------------------
+// depart SAILING_ID
+static void runDepart(BatchContext &context, const Arguments &args)
+{
+    if (!isSailingIDFormat(args[0]))
+    {
+        return writeError(context, "sailing ID must be XXX-DD-HH");
+    }
+    writeResult(context, callFerry(FerryOp::SAILING_DEPART, makeKeyRequest(args[0].c_str())));
+}
+
+//-----------------------------------------------
+// report [SAILING_ID]
+static void runReport(BatchContext &context, const Arguments &args)
+{
+    if (!args.empty())  // One sailing
+    {
+        SailingRow row;
+        FerryStatus status = callFerry(FerryOp::SAILING_GET, makeKeyRequest(args[0].c_str()), row);
+        if (status != FerryStatus::OK) return writeResult(context, status);
+        return writeSailingRow(context, row);
+    }
+
+    // Every sailing, newest first, fetched in large pages
+    uint32_t offset = 0;
+    uint32_t total = 0;
+    do
+    {
+        SailingReportRequest request{offset, REPORT_BATCH_ROWS};
+        vector<char> response;
+        FerryStatus status = callFerry(FerryOp::SAILING_REPORT, &request, sizeof(request), response);
+
+        SailingReportHeader header{};
+        if (status == FerryStatus::OK && response.size() >= sizeof(header))
+        {
+            memcpy(&header, response.data(), sizeof(header));
+        }
+        if (status == FerryStatus::OK && response.size() != sizeof(header) + header.count * sizeof(SailingRow))
+        {
+            status = FerryStatus::BAD_REQUEST;
+        }
+        if (status != FerryStatus::OK) return writeResult(context, status);
+        if (header.count == 0) break;  // Sailings were deleted since the previous page
+
+        for (uint32_t i = 0; i < header.count; ++i)
+        {
+            SailingRow row;
+            memcpy(&row, response.data() + sizeof(header) + i * sizeof(row), sizeof(row));
+            writeSailingRow(context, row);
+        }
+        offset += header.count;
+        total = header.total;
+    } while (offset < total);
+
+    if (offset == 0) writeResult(context, FerryStatus::NOT_FOUND);  // No sailings
+}
+
+//-----------------------------------------------
+// Struct:  BatchCommand
+// Purpose: One command word, its argument count range and its runner.
+struct BatchCommand
+{
+    const char *name;
+    size_t minArgs;
+    size_t maxArgs;
+    void (*run)(BatchContext &, const Arguments &);
+};
+
+static const BatchCommand COMMANDS[] = {
+    {"vessel",         3, 3,                          runVessel},
+    {"sailing",        2, 2,                          runSailing},
+    {"delete-sailing", 1, 1,                          runDeleteSailing},
+    {"reserve",        2, 5,                          runReserve},
+    {"cancel",         2, 2,                          runCancel},
+    {"checkin",        2, 2,                          runCheckIn},
+    {"checkin-batch",  2, 1 + FERRY_MAX_BATCH_PLATES, runCheckInBatch},
+    {"prepare",        1, 1,                          runPrepare},
+    {"depart",         1, 1,                          runDepart},
+    {"report",         0, 1,                          runReport},
+};
+
+//-----------------------------------------------
+// helper: find and run the command named by the first field
+static void runCommand(BatchContext &context, const Arguments &fields)
+{
+    const BatchCommand *command = nullptr;
+    for (const BatchCommand &candidate : COMMANDS)
+    {
+        if (fields[0] == candidate.name) command = &candidate;
+    }
+    if (command == nullptr)
+    {
+        writeError(context, "unknown command");
+        return;
+    }
+
+    Arguments args(fields.begin() + 1, fields.end());
+    if (args.size() < command->minArgs || args.size() > command->maxArgs)
+    {
+        writeError(context, "wrong number of fields");
+        return;
+    }
+    command->run(context, args);
+}
+
+//-----------------------------------------------
+BatchSummary runBatchCommands(istream &in, ostream &out)
+{
+    BatchSummary summary;
+    BatchContext context{0, out, false};
+    string line;
+    Arguments fields;
+
+    while (getline(in, line))  // Loop goal: run every command line
+    {
+        context.line++;
+        bool split = splitFields(line, fields);
+        if (split && (fields.empty() || fields[0][0] == '#')) continue;  // Blank line or comment
+
+        // A command counts once, however many result lines it wrote
+        summary.commands++;
+        context.failed = false;
+        if (split) runCommand(context, fields);
+        else writeError(context, "unterminated quote");
+        if (context.failed) summary.failed++;
+        else summary.succeeded++;
+    }
+    out.flush();
+    return summary;
+}
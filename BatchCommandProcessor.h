@@ -0,0 +1,63 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: BatchCommandProcessor.h
+/*
+    Module: BatchCommandProcessor.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the headless command mode: one command per input
+        line, run through the same requests as the menus, with one
+        tab-separated result line per outcome.
+
+        Commands (fields separated by blanks; "double quotes" keep blanks):
+            vessel NAME LOWCAP HIGHCAP
+            sailing VESSEL SAILING_ID
+            delete-sailing SAILING_ID
+            reserve PLATE SAILING_ID                        registered vehicle
+            reserve PLATE SAILING_ID LENGTH HEIGHT PHONE    new vehicle (metres)
+            cancel PLATE SAILING_ID
+            checkin PLATE SAILING_ID
+            checkin-batch SAILING_ID PLATE [PLATE...]       up to FERRY_MAX_BATCH_PLATES
+            prepare SAILING_ID                              warm check-in up
+            depart SAILING_ID                               end the warm-up
+            report [SAILING_ID]
+        Blank lines and lines starting with '#' are skipped.
+
+        Results:
+            LINE <tab> STATUS [<tab> key=value ...]
+        STATUS is a FerryStatus name (OK, NOT_FOUND, NO_CAPACITY, ...).
+        checkin-batch writes one line per plate and report one line per
+        sailing, all carrying the command's line number.
+*/
+
+#ifndef BATCH_COMMAND_PROCESSOR_H
+#define BATCH_COMMAND_PROCESSOR_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+//-----------------------------------------------
+// Constants
+static constexpr unsigned BATCH_GROUP_TXNS = 1024;  // local runs: fsync after this many commits
+static constexpr unsigned BATCH_GROUP_MS = 50;      // or after this many milliseconds
+
+//-----------------------------------------------
+// Struct:  BatchSummary
+// Purpose: Totals for one batch run.
+struct BatchSummary
+{
+    std::uint64_t commands = 0;   // command lines run
+    std::uint64_t succeeded = 0;  // commands whose every result line was OK
+    std::uint64_t failed = 0;     // commands with at least one other status
+};
+
+//-----------------------------------------------
+BatchSummary runBatchCommands(
+    std::istream &in,    // in: command lines
+    std::ostream &out    // out: result lines
+);
+// Runs every command to the end of input; a failed command does not stop
+// the run. Storage must have been started, or a server connected.
+
+#endif // BATCH_COMMAND_PROCESSOR_H
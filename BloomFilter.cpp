@@ -0,0 +1,185 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: BloomFilter.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the persistent Bloom filter.
+
+        Data Structure: header followed by a power-of-two bit array stored
+                        as 64-bit words
+        Algorithm: k = 7 probes by double hashing (h1 + i*h2), 10 bits per
+                   key at capacity (~1% false positives); the whole array
+                   is loaded at open and written back at close
+*/
+
+//============================================
+
+#include <fstream>
+#include <iostream>
+#include "BloomFilter.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr uint32_t FILTER_MAGIC = 0x4D4F4C42;     // "BLOM"
+static constexpr uint32_t FILTER_VERSION = 1;
+static constexpr uint32_t HASH_COUNT = 7;
+static constexpr uint64_t BITS_PER_KEY = 10;
+static constexpr uint64_t MIN_CAPACITY = 1024;
+
+//-----------------------------------------------
+// helper: second, independent-enough hash for double hashing (odd, so
+// every probe step visits a distinct bit of the power-of-two array)
+static uint64_t secondHash(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 29;
+    return h | 1;
+}
+
+//-----------------------------------------------
+bool BloomFilter::open(const string &path, uint64_t dataFileSize)
+{
+    filePath = path;
+    bits.clear();
+    resetStatistics();
+
+    ifstream file(path, ios::binary);
+    if (!file.is_open()) return false;  // No saved filter yet
+
+    Header header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(Header))) return false;
+
+    bool usable = header.magic == FILTER_MAGIC &&
+                  header.version == FILTER_VERSION &&
+                  header.clean == 1 &&
+                  header.dataFileSize == dataFileSize &&
+                  header.bitCount >= 64 &&
+                  (header.bitCount & (header.bitCount - 1)) == 0;
+    if (!usable) return false;
+
+    bits.resize(header.bitCount / 64);
+    if (!file.read(reinterpret_cast<char*>(bits.data()), bits.size() * sizeof(uint64_t)))
+    {
+        bits.clear();
+        return false;
+    }
+    file.close();
+
+    hashCount = header.hashCount;
+    stats.keyCount = header.keyCount;
+    stats.capacity = header.capacity;
+
+    // Mark the filter as in use so a crash before close() forces a rebuild
+    return writeHeader(0, 0);
+}
+
+//-----------------------------------------------
+void BloomFilter::close(uint64_t dataFileSize)
+{
+    if (bits.empty()) return;
+
+    ofstream file(filePath, ios::binary | ios::trunc);
+    if (!file.is_open())
+    {
+        cerr << "Error: Failed to save filter file " << filePath << "." << endl;
+    }
+    else
+    {
+        // Bits first, then the clean header, so a torn write is never trusted
+        Header header{FILTER_MAGIC, FILTER_VERSION, bits.size() * 64, stats.keyCount,
+                      stats.capacity, hashCount, 0, dataFileSize};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        file.write(reinterpret_cast<const char*>(bits.data()), bits.size() * sizeof(uint64_t));
+        file.close();
+        writeHeader(1, dataFileSize);
+    }
+    bits.clear();
+    resetStatistics();
+}
+
+//-----------------------------------------------
+void BloomFilter::rebuild(uint64_t expectedKeys)
+{
+    // Room for twice the current keys before the false positive rate climbs
+    uint64_t bitCount = 64;
+    while (bitCount < max(expectedKeys * 2, MIN_CAPACITY) * BITS_PER_KEY)
+    {
+        bitCount <<= 1;
+    }
+
+    bits.assign(bitCount / 64, 0);
+    hashCount = HASH_COUNT;
+    resetStatistics();
+    stats.capacity = bitCount / BITS_PER_KEY;
+}
+
+//-----------------------------------------------
+void BloomFilter::add(uint64_t keyHash)
+{
+    if (bits.empty()) return;
+
+    const uint64_t mask = bits.size() * 64 - 1;
+    const uint64_t step = secondHash(keyHash);
+    for (uint32_t i = 0; i < hashCount; ++i)
+    {
+        uint64_t bit = (keyHash + i * step) & mask;
+        bits[bit >> 6] |= 1ull << (bit & 63);
+    }
+    stats.keyCount++;
+}
+
+//-----------------------------------------------
+bool BloomFilter::mayContain(uint64_t keyHash) const
+{
+    if (bits.empty()) return true;  // No filter: every key must be looked up
+    queries.fetch_add(1, memory_order_relaxed);
+
+    const uint64_t mask = bits.size() * 64 - 1;
+    const uint64_t step = secondHash(keyHash);
+    for (uint32_t i = 0; i < hashCount; ++i)
+    {
+        uint64_t bit = (keyHash + i * step) & mask;
+        if ((bits[bit >> 6] & (1ull << (bit & 63))) == 0)
+        {
+            definiteAbsent.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------
+bool BloomFilter::writeHeader(uint32_t clean, uint64_t dataFileSize)
+{
+    fstream file(filePath, ios::binary | ios::in | ios::out);
+    if (!file.is_open()) return false;
+
+    Header header{FILTER_MAGIC, FILTER_VERSION, bits.size() * 64, stats.keyCount,
+                  stats.capacity, hashCount, clean, dataFileSize};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    return file.good();
+}
+
+//-----------------------------------------------
+BloomFilterStats BloomFilter::statistics() const
+{
+    BloomFilterStats snapshot = stats;
+    snapshot.queries = queries.load(memory_order_relaxed);
+    snapshot.definiteAbsent = definiteAbsent.load(memory_order_relaxed);
+    snapshot.falsePositives = falsePositives.load(memory_order_relaxed);
+    return snapshot;
+}
+
+//-----------------------------------------------
+// helper: zero every counter (open, close, rebuild)
+void BloomFilter::resetStatistics()
+{
+    stats = BloomFilterStats{};
+    queries = 0;
+    definiteAbsent = 0;
+    falsePositives = 0;
+}
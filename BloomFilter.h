@@ -0,0 +1,123 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: BloomFilter.h
+/*
+    Module: BloomFilter.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of a persistent Bloom filter over 64-bit key hashes.
+        A storage module asks it whether a key may exist before paying for
+        a lookup: "no" is definite, "maybe" must be confirmed. The bit array
+        lives in memory and is saved to its own file on close.
+*/
+
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------
+// Struct:  BloomFilterStats
+// Purpose: Query counters since the filter was opened or rebuilt.
+struct BloomFilterStats
+{
+    std::uint64_t queries = 0;          // mayContain() calls
+    std::uint64_t definiteAbsent = 0;   // answered "no"; the lookup was skipped
+    std::uint64_t falsePositives = 0;   // answered "maybe" but the key was absent
+    std::uint64_t keyCount = 0;         // keys added since the last rebuild
+    std::uint64_t capacity = 0;         // keys the bit array is sized for
+
+    double falsePositiveRate() const
+    {
+        std::uint64_t absent = definiteAbsent + falsePositives;
+        return absent == 0 ? 0.0 : static_cast<double>(falsePositives) / absent;
+    }
+    // Fraction of absent keys the filter failed to rule out.
+};
+
+//-----------------------------------------------
+// Class:   BloomFilter
+// Purpose: k-probe Bloom filter (double hashing over one 64-bit key hash).
+//          Keys cannot be removed; deleted keys linger as false positives
+//          until the owner rebuilds the filter from its data file.
+//          mayContain() and recordFalsePositive() may run on several threads
+//          at once (the query counters are atomic); every other call needs
+//          the owner's exclusive lock.
+class BloomFilter
+{
+public:
+    //-----------------------------------------------
+    bool open(
+        const std::string &path,     // in: filter file path
+        std::uint64_t dataFileSize   // in: current size of the data file it describes
+    );
+    // Loads the saved bit array. Returns false if the file is missing,
+    // corrupt, was not closed cleanly or describes a different data file
+    // size; the caller must then rebuild() and re-add every key.
+
+    //-----------------------------------------------
+    void close(
+        std::uint64_t dataFileSize   // in: final size of the data file
+    );
+    // Writes the bit array and a clean header, then releases memory.
+
+    //-----------------------------------------------
+    void rebuild(
+        std::uint64_t expectedKeys   // in: number of keys about to be added
+    );
+    // Clears every bit and sizes the array for expectedKeys (with headroom).
+
+    //-----------------------------------------------
+    void add(
+        std::uint64_t keyHash        // in: hash of the key
+    );
+
+    //-----------------------------------------------
+    bool mayContain(
+        std::uint64_t keyHash        // in: hash of the key
+    ) const;
+    // False means the key was never added. Counts the query.
+
+    //-----------------------------------------------
+    void recordFalsePositive() const { falsePositives.fetch_add(1, std::memory_order_relaxed); }
+    // Called by the owner when a "maybe" turned out to be absent.
+
+    //-----------------------------------------------
+    bool isSaturated() const { return stats.keyCount > stats.capacity; }
+    // True once more keys were added than the array was sized for.
+
+    //-----------------------------------------------
+    BloomFilterStats statistics() const;
+    // Snapshot of the counters.
+
+private:
+    struct Header
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint64_t bitCount;      // always a power of two
+        std::uint64_t keyCount;
+        std::uint64_t capacity;
+        std::uint32_t hashCount;
+        std::uint32_t clean;         // 1 if closed cleanly, 0 while open
+        std::uint64_t dataFileSize;  // size of data file the filter describes
+    };
+
+    bool writeHeader(std::uint32_t clean, std::uint64_t dataFileSize);
+    void resetStatistics();
+
+    std::string filePath;
+    std::vector<std::uint64_t> bits;
+    std::uint32_t hashCount = 0;
+    BloomFilterStats stats;  // keyCount and capacity; the query counters live below
+
+    // Query counters, bumped by concurrent readers
+    mutable std::atomic<std::uint64_t> queries{0};
+    mutable std::atomic<std::uint64_t> definiteAbsent{0};
+    mutable std::atomic<std::uint64_t> falsePositives{0};
+};
+
+#endif // BLOOM_FILTER_H
@@ -0,0 +1,654 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: DataFormat.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the data file format check and upgrades.
+
+        Stamp: ferry.format holds {magic, version}; data files without a
+               stamp predate it and are DATA_FORMAT_METRES.
+        Formats: 1 and 2 are headerless dumps of the in-memory structs
+               (lengths in float metres, then int32 centimetres); 3 is the
+               v2 record file (header + packed records, RecordFormat.h),
+               written in one streaming pass per file; 4 splits
+               reservations.dat into one v2 file per sailing
+               (reservations/<sailing ID>.dat) listed in reservations.dir
+               (PartitionDirectory.h).
+        Upgrade (crash-safe): older data steps up one format at a time.
+               Each step writes its output beside the originals
+               (<file>.upgrade, or reservations.upgrade/ and
+               reservations.dir.upgrade for the split) and fsyncs it, then
+               the new stamp is written atomically (temp file + rename) -
+               the commit point - and only then are the copies renamed over
+               the originals. A start that finds copies under an old stamp
+               discards them and converts again; under the stamp that
+               committed them it finishes the renames.
+        Rejects: a struct the packed format cannot hold (a sailing ID
+               outside AAA-01-00..zzz-31-23 and every reservation on it, a
+               date or field out of range) is reported on stderr and kept,
+               as a format 2 struct, in <file>.rejected for the operator;
+               its slot is stored as a tombstone. Pending log entries for
+               such a sailing are not applied on replay.
+        Slots: every struct becomes one packed record and zeroed
+               tombstones stay zeroed, so free-slot lists stay valid; the
+               indexes and Bloom filter are removed and rebuilt on open
+               because their data file sizes changed. The write-ahead log
+               holds in-memory structs, so it only needs the metres fix-up.
+        Split: one pass over reservations.dat moves each live record, as
+               stored, to its sailing's file (a buffer per sailing, appended
+               a block at a time); tombstones are dropped, so the new files
+               start without free slots.
+*/
+
+//============================================
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "DataFormat.h"
+#include "LittleEndian.h"
+#include "PartitionDirectory.h"
+#include "RecordFormat.h"
+#include "RecordStore.h"
+#include "Units.h"
+#include "WriteAheadLog.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr uint32_t DATA_FORMAT_MAGIC = 0x544D4646;  // "FFMT"
+static const char* FORMAT_FILE = "ferry.format";
+static const char* UPGRADE_SUFFIX = ".upgrade";
+static const char* REJECTED_SUFFIX = ".rejected";
+
+// Files whose contents depend on the format (the write-ahead log last)
+static const char* SAILING_FILE = "sailings.dat";
+static const char* RESERVATION_FILE = "reservations.dat";
+static const char* VEHICLE_FILE = "vehicles.dat";
+static const char* VESSEL_FILE = "vessels.dat";
+static const char* WAL_FILE = "ferry.wal";
+static const char* const FORMAT_FILES[] = {SAILING_FILE, RESERVATION_FILE, VEHICLE_FILE, VESSEL_FILE, WAL_FILE};
+
+// Reservations from format 4 on: a folder of per-sailing files and their directory
+static const char* RESERVATION_PARTITION_DIR = "reservations";
+static const char* RESERVATION_DIRECTORY_FILE = "reservations.dir";
+
+// Files the storage modules rebuild from the data files when missing
+static const char* const DERIVED_FILES[] = {"reservations.idx", "reservations.bloom", "vehicles.idx"};
+
+struct FormatStamp
+{
+    uint32_t magic;
+    uint32_t version;
+};
+
+//-----------------------------------------------
+// helper: size of a file, or -1 if it does not exist
+static long long fileSize(const string &path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? static_cast<long long>(st.st_size) : -1;
+}
+
+//-----------------------------------------------
+// helper: write the whole buffer, retrying short writes
+static bool writeAll(int fd, const unsigned char *data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = ::write(fd, data, length);
+        if (written < 0) return false;
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+//-----------------------------------------------
+// helper: write a whole file and fsync it
+static bool writeDurably(const string &path, const unsigned char *data, size_t length)
+{
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    bool ok = writeAll(fd, data, length) && fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+}
+
+//-----------------------------------------------
+// helper: make renames in the working directory durable
+static void syncDirectory()
+{
+    int fd = ::open(".", O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+    ::close(fd);
+}
+
+//-----------------------------------------------
+// helper: true if the file starts with a v2 record file header
+static bool isRecordFile(const char *path)
+{
+    ifstream in(path, ios::binary);
+    unsigned char bytes[RECORD_FILE_HEADER_BYTES];
+    if (!in.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) return false;
+    return loadRecordFileHeader(bytes).magic == RECORD_FILE_MAGIC;
+}
+
+//-----------------------------------------------
+// helper: the stamped format. Unstamped data written by a tool that
+// skipped startup is recognised by a partition directory or by v2 record
+// headers; other unstamped files are the original metres format, and a
+// directory without data files is new, so it gets the current format
+static uint32_t readFormat()
+{
+    ifstream in(FORMAT_FILE, ios::binary);
+    FormatStamp stamp{};
+    if (in.read(reinterpret_cast<char*>(&stamp), sizeof(stamp)))
+    {
+        return stamp.magic == DATA_FORMAT_MAGIC ? stamp.version : 0;
+    }
+    if (fileSize(RESERVATION_DIRECTORY_FILE) >= 0) return DATA_FORMAT_PARTITIONED;
+    for (const char *file : FORMAT_FILES)
+    {
+        if (isRecordFile(file)) return DATA_FORMAT_PACKED;
+    }
+    for (const char *file : FORMAT_FILES)
+    {
+        if (fileSize(file) > 0) return DATA_FORMAT_METRES;
+    }
+    return DATA_FORMAT_CURRENT;
+}
+
+//-----------------------------------------------
+// helper: atomically replace the stamp (the upgrade's commit point)
+static bool writeFormat(uint32_t version)
+{
+    FormatStamp stamp{DATA_FORMAT_MAGIC, version};
+    string temp = string(FORMAT_FILE) + ".tmp";
+    if (!writeDurably(temp, reinterpret_cast<const unsigned char*>(&stamp), sizeof(stamp))) return false;
+    if (rename(temp.c_str(), FORMAT_FILE) != 0) return false;
+    syncDirectory();
+    return true;
+}
+
+//-----------------------------------------------
+// helper: a length that was stored as float metres, now in the same 4 bytes
+static void metresToCentimetres(int32_t &field)
+{
+    float metres;
+    memcpy(&metres, &field, sizeof(metres));
+    field = toCentimetres(metres);
+}
+
+//-----------------------------------------------
+// helper: a vessel capacity that was stored as int32 metres
+static void wholeMetresToCentimetres(int32_t &field)
+{
+    field = field <= 0 ? 0 : toCentimetres(static_cast<double>(field));
+}
+
+// Headerless struct dumps (formats 1 and 2): the in-memory struct, its
+// codec, the key that is empty in a tombstone and the metres fix-up
+struct LegacyReservations
+{
+    using Struct = Reservation;
+    using Codec = ReservationCodec;
+    static const char *key(const Reservation &r) { return r.id; }
+    static void fromMetres(Reservation &r)
+    {
+        metresToCentimetres(r.vehicleLength);
+        metresToCentimetres(r.vehicleHeight);
+    }
+};
+
+struct LegacySailings
+{
+    using Struct = Sailing;
+    using Codec = SailingCodec;
+    static const char *key(const Sailing &s) { return s.id; }
+    static void fromMetres(Sailing &s)
+    {
+        metresToCentimetres(s.LRL);
+        metresToCentimetres(s.HRL);
+    }
+};
+
+struct LegacyVehicles
+{
+    using Struct = Vehicle;
+    using Codec = VehicleCodec;
+    static const char *key(const Vehicle &v) { return v.licensePlate; }
+    static void fromMetres(Vehicle &v)
+    {
+        metresToCentimetres(v.vehicleLength);
+        metresToCentimetres(v.vehicleHeight);
+    }
+};
+
+struct LegacyVessels
+{
+    using Struct = Vessel;
+    using Codec = VesselCodec;
+    static const char *key(const Vessel &v) { return v.name; }
+    static void fromMetres(Vessel &v)
+    {
+        wholeMetresToCentimetres(v.lowCap);
+        wholeMetresToCentimetres(v.highCap);
+    }
+};
+
+//-----------------------------------------------
+// helper: stream a headerless struct dump into <path>.upgrade as a v2
+// record file: header, then one packed record per struct, a block at a
+// time. A partial trailing struct is dropped, as RecordStore always did.
+// A struct the codec cannot pack (e.g. a sailing ID the old create screen
+// let through, such as "V1C-45-30") is quarantined: it is appended, as the
+// centimetres struct, to <path>.rejected and its slot becomes a tombstone,
+// so one bad record no longer blocks the whole upgrade.
+template <typename Legacy>
+static bool packRecordFile(const char *path, bool fromMetres, vector<DataFileUpgrade> &upgraded)
+{
+    using Struct = typename Legacy::Struct;
+    using Record = typename Legacy::Codec::Record;
+
+    ifstream in(path, ios::binary);
+    if (!in) return true;  // Nothing stored yet
+    string copy = string(path) + UPGRADE_SUFFIX;
+    int out = ::open(copy.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out < 0) return false;
+
+    DataFileUpgrade report;
+    report.file = path;
+    report.bytesBefore = static_cast<uint64_t>(fileSize(path));
+    unsigned char header[RECORD_FILE_HEADER_BYTES] = {};  // Filled in once the records are counted
+    bool ok = writeAll(out, header, sizeof(header));
+    string rejectedPath = string(path) + REJECTED_SUFFIX;
+    int rejected = -1;  // Opened on the first record the packed format cannot hold
+
+    const size_t perBlock = max<size_t>(1, RECORD_STORE_SCAN_BLOCK_BYTES / sizeof(Struct));
+    vector<Struct> block(perBlock);
+    vector<Record> packed(perBlock);
+    uint64_t checksum = RECORD_FILE_CHECKSUM_SEED;
+    // Loop goal: read, convert and write one block of records at a time
+    while (ok && in)
+    {
+        in.read(reinterpret_cast<char*>(block.data()), static_cast<streamsize>(perBlock * sizeof(Struct)));
+        size_t n = static_cast<size_t>(in.gcount()) / sizeof(Struct);
+        for (size_t i = 0; i < n && ok; ++i)
+        {
+            memset(static_cast<void*>(&packed[i]), 0, sizeof(Record));
+            if (Legacy::key(block[i])[0] == '\0') continue;  // Tombstones stay zeroed
+            if (fromMetres) Legacy::fromMetres(block[i]);
+            if (Legacy::Codec::encode(block[i], packed[i])) continue;
+
+            // Quarantined: the struct goes to <path>.rejected, its slot becomes a tombstone
+            memset(static_cast<void*>(&packed[i]), 0, sizeof(Record));
+            if (rejected < 0) rejected = ::open(rejectedPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            ok = rejected >= 0 && writeAll(rejected, reinterpret_cast<const unsigned char*>(&block[i]), sizeof(Struct));
+            cerr << "Warning: Record " << report.records + i << " (" << Legacy::key(block[i]) << ") of " << path
+                 << " has a sailing ID, date or field the packed format cannot hold; moved to "
+                 << rejectedPath << "." << endl;
+            ++report.rejected;
+        }
+        ok = ok && writeAll(out, reinterpret_cast<const unsigned char*>(packed.data()), n * sizeof(Record));
+        checksum = recordFileChecksum(checksum, packed.data(), sizeof(Record), n);
+        report.records += n;
+    }
+
+    RecordFileHeader fields;
+    fields.recordSize = sizeof(Record);
+    fields.clean = 1;
+    fields.count = report.records;
+    fields.checksum = checksum;
+    storeRecordFileHeader(fields, header);
+    ok = ok && pwrite(out, header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) && fsync(out) == 0;
+    ::close(out);
+    if (rejected >= 0)
+    {
+        ok = fsync(rejected) == 0 && ok;
+        ::close(rejected);
+    }
+
+    report.bytesAfter = RECORD_FILE_HEADER_BYTES + report.records * sizeof(Record);
+    if (ok) upgraded.push_back(report);
+    return ok;
+}
+
+//-----------------------------------------------
+// helper: convert every file into its .upgrade copy
+static bool writePackedCopies(bool fromMetres, vector<DataFileUpgrade> &upgraded)
+{
+    bool ok = packRecordFile<LegacySailings>(SAILING_FILE, fromMetres, upgraded) &&
+              packRecordFile<LegacyReservations>(RESERVATION_FILE, fromMetres, upgraded) &&
+              packRecordFile<LegacyVehicles>(VEHICLE_FILE, fromMetres, upgraded) &&
+              packRecordFile<LegacyVessels>(VESSEL_FILE, fromMetres, upgraded);
+    if (!ok || !fromMetres || fileSize(WAL_FILE) <= 0) return ok;
+
+    // Committed transactions not yet checkpointed carry whole records too
+    return rewriteWriteAheadLog(WAL_FILE, string(WAL_FILE) + UPGRADE_SUFFIX, [](WalOp op, char *payload, size_t length) {
+        if (op == WalOp::RESERVATION_PUT && length == sizeof(Reservation))
+        {
+            Reservation r;
+            memcpy(&r, payload, sizeof(r));
+            LegacyReservations::fromMetres(r);
+            memcpy(payload, &r, sizeof(r));
+        }
+        else if ((op == WalOp::SAILING_ADD || op == WalOp::SAILING_UPDATE) && length == sizeof(Sailing))
+        {
+            Sailing s;
+            memcpy(&s, payload, sizeof(s));
+            LegacySailings::fromMetres(s);
+            memcpy(payload, &s, sizeof(s));
+        }
+    });
+}
+
+//-----------------------------------------------
+// helper: move (install = true) or discard every .upgrade copy; installed
+// data files invalidate the files derived from them
+static bool settleCopies(bool install)
+{
+    bool ok = true;
+    bool installed = false;
+    for (const char *file : FORMAT_FILES)
+    {
+        string copy = string(file) + UPGRADE_SUFFIX;
+        if (fileSize(copy) < 0) continue;
+        if (install ? rename(copy.c_str(), file) != 0 : unlink(copy.c_str()) != 0)
+        {
+            cerr << "Error: Could not " << (install ? "install " : "remove ") << copy << ": "
+                 << strerror(errno) << "." << endl;
+            ok = false;
+        }
+        installed = installed || install;
+    }
+    for (const char *file : DERIVED_FILES)
+    {
+        if (installed) unlink(file);
+    }
+    syncDirectory();
+    return ok;
+}
+
+//-----------------------------------------------
+// helper: one sailing's file being written by splitReservationFile
+struct PartitionCopy
+{
+    vector<ReservationRecord> pending;  // records not yet appended
+    uint64_t records = 0;               // records already in the file
+    uint64_t checksum = RECORD_FILE_CHECKSUM_SEED;
+};
+
+//-----------------------------------------------
+// helper: the file of a sailing's partition inside folder
+static string partitionFile(const string &folder, uint32_t sailingCode)
+{
+    char sailingID[sizeof(Sailing::id)];
+    decodeSailingID(sailingCode, sailingID);
+    return folder + "/" + sailingID + ".dat";
+}
+
+//-----------------------------------------------
+// helper: append a partition's pending records to its file, which the
+// first call creates behind a placeholder header
+static bool flushPartitionCopy(const string &path, PartitionCopy &copy)
+{
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) return false;
+    unsigned char header[RECORD_FILE_HEADER_BYTES] = {};
+    bool ok = copy.records > 0 || writeAll(fd, header, sizeof(header));
+    ok = ok && writeAll(fd, reinterpret_cast<const unsigned char*>(copy.pending.data()),
+                        copy.pending.size() * sizeof(ReservationRecord));
+    ::close(fd);
+
+    copy.checksum = recordFileChecksum(copy.checksum, copy.pending.data(), sizeof(ReservationRecord), copy.pending.size());
+    copy.records += copy.pending.size();
+    copy.pending.clear();
+    return ok;
+}
+
+//-----------------------------------------------
+// helper: write a partition's final header (clean, count, checksum) and fsync it
+static bool finishPartitionCopy(const string &path, const PartitionCopy &copy)
+{
+    RecordFileHeader fields;
+    fields.recordSize = sizeof(ReservationRecord);
+    fields.clean = 1;
+    fields.count = copy.records;
+    fields.checksum = copy.checksum;
+    unsigned char header[RECORD_FILE_HEADER_BYTES];
+    storeRecordFileHeader(fields, header);
+
+    int fd = ::open(path.c_str(), O_WRONLY);
+    if (fd < 0) return false;
+    bool ok = pwrite(fd, header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) && fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+}
+
+//-----------------------------------------------
+// helper: delete a folder and the files in it (partition folders hold no subfolders)
+static bool removeFolder(const string &path)
+{
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr) return errno == ENOENT;
+    while (dirent *entry = readdir(dir))
+    {
+        if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+        {
+            unlink((path + "/" + entry->d_name).c_str());
+        }
+    }
+    closedir(dir);
+    return rmdir(path.c_str()) == 0;
+}
+
+//-----------------------------------------------
+// helper: split reservations.dat (format 3) into reservations.upgrade/,
+// one v2 file per sailing, plus reservations.dir.upgrade listing them
+static bool splitReservationFile(vector<DataFileUpgrade> &upgraded)
+{
+    ifstream in(RESERVATION_FILE, ios::binary);
+    if (!in) return true;  // Nothing booked yet
+
+    DataFileUpgrade report;
+    report.file = string(RESERVATION_PARTITION_DIR) + "/";
+    report.bytesBefore = static_cast<uint64_t>(fileSize(RESERVATION_FILE));
+
+    // Same header checks as RecordStore::open(); an empty file holds no records
+    unsigned char headerBytes[RECORD_FILE_HEADER_BYTES] = {};
+    uint64_t count = 0;
+    RecordFileHeader header;
+    if (report.bytesBefore > 0)
+    {
+        in.read(reinterpret_cast<char*>(headerBytes), sizeof(headerBytes));
+        header = loadRecordFileHeader(headerBytes);
+        if (!in || header.magic != RECORD_FILE_MAGIC || header.version != RECORD_FILE_VERSION ||
+            header.recordSize != sizeof(ReservationRecord))
+        {
+            cerr << "Error: " << RESERVATION_FILE << " is not a v" << RECORD_FILE_VERSION << " record file." << endl;
+            return false;
+        }
+        count = (report.bytesBefore - RECORD_FILE_HEADER_BYTES) / sizeof(ReservationRecord);
+        if (header.clean && header.count > count)
+        {
+            cerr << "Error: " << RESERVATION_FILE << " is shorter than its header says." << endl;
+            return false;
+        }
+        if (header.clean) count = header.count;
+    }
+
+    const string folder = string(RESERVATION_PARTITION_DIR) + UPGRADE_SUFFIX;
+    if (mkdir(folder.c_str(), 0755) != 0) return false;
+
+    const size_t perBlock = max<size_t>(1, RECORD_STORE_SCAN_BLOCK_BYTES / sizeof(ReservationRecord));
+    vector<ReservationRecord> block(perBlock);
+    map<uint32_t, PartitionCopy> copies;  // sailing code -> its file, in directory order
+    uint64_t checksum = RECORD_FILE_CHECKSUM_SEED;
+    bool ok = true;
+    // Loop goal: read one block of records and hand each live one to its sailing's buffer
+    for (uint64_t done = 0; ok && done < count;)
+    {
+        size_t n = static_cast<size_t>(min<uint64_t>(perBlock, count - done));
+        in.read(reinterpret_cast<char*>(block.data()), static_cast<streamsize>(n * sizeof(ReservationRecord)));
+        if (!in)
+        {
+            cerr << "Error: Failed to read " << RESERVATION_FILE << "." << endl;
+            ok = false;
+            break;
+        }
+        checksum = recordFileChecksum(checksum, block.data(), sizeof(ReservationRecord), n);
+        for (size_t i = 0; i < n && ok; ++i)
+        {
+            if (!ReservationCodec::isLive(block[i])) continue;  // Tombstones are not carried over
+            const uint32_t code = loadLittleEndian<uint32_t>(block[i].sailing);
+            PartitionCopy &copy = copies[code];
+            copy.pending.push_back(block[i]);
+            if (copy.pending.size() == perBlock) ok = flushPartitionCopy(partitionFile(folder, code), copy);
+        }
+        done += n;
+    }
+    if (ok && header.clean && checksum != header.checksum)
+    {
+        cerr << "Error: " << RESERVATION_FILE << " failed its checksum." << endl;
+        ok = false;
+    }
+
+    vector<uint32_t> keys;
+    for (auto &c : copies)
+    {
+        const string path = partitionFile(folder, c.first);
+        ok = ok && (c.second.pending.empty() || flushPartitionCopy(path, c.second)) && finishPartitionCopy(path, c.second);
+        keys.push_back(c.first);
+        report.records += c.second.records;
+        report.bytesAfter += RECORD_FILE_HEADER_BYTES + c.second.records * sizeof(ReservationRecord);
+    }
+    if (!ok || !PartitionDirectory::write(string(RESERVATION_DIRECTORY_FILE) + UPGRADE_SUFFIX, keys)) return false;
+
+    // The new files' names must be durable before the stamp commits them
+    int dirFd = ::open(folder.c_str(), O_RDONLY);
+    if (dirFd >= 0)
+    {
+        fsync(dirFd);
+        ::close(dirFd);
+    }
+    report.bytesAfter += fileSize(string(RESERVATION_DIRECTORY_FILE) + UPGRADE_SUFFIX);
+    upgraded.push_back(report);
+    return true;
+}
+
+//-----------------------------------------------
+// helper: move (install = true) or discard the split's copies. Installing
+// renames the folder, then the directory file, then removes the file they
+// replace, so a start that repeats it after a crash picks up where it
+// stopped; at format 4 reservations.dat is never read, so it always goes.
+static bool settlePartitions(bool install)
+{
+    const string folderCopy = string(RESERVATION_PARTITION_DIR) + UPGRADE_SUFFIX;
+    const string directoryCopy = string(RESERVATION_DIRECTORY_FILE) + UPGRADE_SUFFIX;
+    bool ok = true;
+    if (!install)
+    {
+        ok = removeFolder(folderCopy) && (unlink(directoryCopy.c_str()) == 0 || errno == ENOENT);
+        if (!ok) cerr << "Error: Could not remove " << folderCopy << ": " << strerror(errno) << "." << endl;
+        syncDirectory();
+        return ok;
+    }
+
+    bool installed = false;
+    if (fileSize(folderCopy) >= 0)
+    {
+        // Nothing has opened the partitions yet: the copies are the whole set
+        ok = removeFolder(RESERVATION_PARTITION_DIR) && rename(folderCopy.c_str(), RESERVATION_PARTITION_DIR) == 0;
+        installed = true;
+    }
+    if (ok && fileSize(directoryCopy) >= 0)
+    {
+        ok = rename(directoryCopy.c_str(), RESERVATION_DIRECTORY_FILE) == 0;
+        installed = true;
+    }
+    if (!ok)
+    {
+        cerr << "Error: Could not install " << folderCopy << ": " << strerror(errno) << "." << endl;
+        return false;
+    }
+    if (fileSize(RESERVATION_FILE) >= 0)
+    {
+        unlink(RESERVATION_FILE);
+        unlink((string(RESERVATION_FILE) + ".free").c_str());
+        installed = true;
+    }
+    for (const char *file : DERIVED_FILES)
+    {
+        if (installed) unlink(file);
+    }
+    syncDirectory();
+    return true;
+}
+
+//============================================
+bool upgradeDataFiles(vector<DataFileUpgrade> *upgraded)
+{
+    uint32_t version = readFormat();
+    if (version == DATA_FORMAT_CURRENT)
+    {
+        // A crash after the stamp may have left the split's copies behind
+        return settlePartitions(true) && (fileSize(FORMAT_FILE) >= 0 || writeFormat(DATA_FORMAT_CURRENT));
+    }
+    if (version != DATA_FORMAT_METRES && version != DATA_FORMAT_CENTIMETRES && version != DATA_FORMAT_PACKED)
+    {
+        cerr << "Error: " << FORMAT_FILE << " names an unknown data format (" << version << ")." << endl;
+        return false;
+    }
+
+    vector<DataFileUpgrade> report;
+    if (version != DATA_FORMAT_PACKED)
+    {
+        // Copies from an interrupted upgrade were never committed; start over
+        if (!settleCopies(false)) return false;
+        if (!writePackedCopies(version == DATA_FORMAT_METRES, report))
+        {
+            cerr << "Error: Failed to convert the data files to format " << DATA_FORMAT_PACKED << "." << endl;
+            settleCopies(false);
+            return false;
+        }
+        if (!writeFormat(DATA_FORMAT_PACKED))
+        {
+            cerr << "Error: Failed to record the upgraded data format." << endl;
+            settleCopies(false);
+            return false;
+        }
+    }
+    // Finishes the step above, or one a crash interrupted after its stamp
+    if (!settleCopies(true)) return false;
+
+    // Format 3 -> 4: split reservations.dat by sailing
+    if (!settlePartitions(false)) return false;
+    if (!splitReservationFile(report))
+    {
+        cerr << "Error: Failed to convert the data files to format " << DATA_FORMAT_PARTITIONED << "." << endl;
+        settlePartitions(false);
+        return false;
+    }
+    if (!writeFormat(DATA_FORMAT_PARTITIONED))
+    {
+        cerr << "Error: Failed to record the upgraded data format." << endl;
+        settlePartitions(false);
+        return false;
+    }
+    if (upgraded != nullptr) *upgraded = report;
+    return settlePartitions(true);
+}
@@ -0,0 +1,52 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: DataFormat.h
+/*
+    Module: DataFormat.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the data file format check run before storage opens.
+        The format in use is recorded in a small stamp file beside the data
+        files; older files are upgraded in place, crash-safely, before any
+        ASM reads them.
+*/
+
+#ifndef DATA_FORMAT_H
+#define DATA_FORMAT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------
+// Constants
+static constexpr std::uint32_t DATA_FORMAT_METRES = 1;       // lengths as float metres (no stamp file)
+static constexpr std::uint32_t DATA_FORMAT_CENTIMETRES = 2;  // lengths as int32 centimetres
+static constexpr std::uint32_t DATA_FORMAT_PACKED = 3;       // v2 record files: header + packed records
+static constexpr std::uint32_t DATA_FORMAT_PARTITIONED = 4;  // reservations split into one v2 file per sailing
+static constexpr std::uint32_t DATA_FORMAT_CURRENT = DATA_FORMAT_PARTITIONED;
+
+//-----------------------------------------------
+// Struct:  DataFileUpgrade
+// Purpose: One data file rewritten by upgradeDataFiles().
+struct DataFileUpgrade
+{
+    std::string file;
+    std::uint64_t records = 0;       // slots converted, tombstones included (records moved, for a split)
+    std::uint64_t bytesBefore = 0;
+    std::uint64_t bytesAfter = 0;
+    std::uint64_t rejected = 0;      // records the packed format cannot hold, moved to <file>.rejected
+};
+
+//-----------------------------------------------
+bool upgradeDataFiles(
+    std::vector<DataFileUpgrade> *upgraded = nullptr  // out: files rewritten (none if already current)
+);
+// out: false if the files are in an unknown (newer) format or an upgrade
+//      step failed; the files are then left in a format the next start can
+//      still read or finish upgrading
+// Purpose: Bring the data files and the write-ahead log in the working
+//          directory up to DATA_FORMAT_CURRENT. Must run before any storage
+//          module is initialized.
+
+#endif // DATA_FORMAT_H
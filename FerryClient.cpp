@@ -0,0 +1,125 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: FerryClient.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the client side of the request protocol: one
+        blocking request/response round trip per call over a Unix domain
+        socket, or a direct handler call when no server is connected.
+*/
+
+//============================================
+
+#include <iostream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "FerryClient.h"
+#include "RequestHandlers.h"
+
+using namespace std;
+
+//============================================
+
+static bool remote = false;     // false: run requests in-process
+static string serverPath;       // socket to (re)connect to
+static int serverSocket = -1;   // -1 while remote: reconnect on the next call
+
+//-----------------------------------------------
+// helper: connected socket, or -1
+static int openConnection(const string &socketPath)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path)) return -1;
+    copyKey(address.sun_path, sizeof(address.sun_path), socketPath.c_str());
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+//-----------------------------------------------
+bool connectFerryServer(const string &socketPath)
+{
+    int fd = openConnection(socketPath);
+    if (fd < 0)
+    {
+        cerr << "Error: No ferry server is listening on " << socketPath << "." << endl;
+        return false;
+    }
+
+    disconnectFerryServer();
+    remote = true;
+    serverPath = socketPath;
+    serverSocket = fd;
+    return true;
+}
+
+//-----------------------------------------------
+void disconnectFerryServer()
+{
+    if (serverSocket >= 0) ::close(serverSocket);
+    serverSocket = -1;
+    remote = false;
+}
+
+//-----------------------------------------------
+FerryStatus callFerry(FerryOp op, const void *request, size_t length, vector<char> &response)
+{
+    if (!remote)
+    {
+        return handleFerryRequest(op, static_cast<const char*>(request), length, response);
+    }
+
+    // A lost connection is retried once per call (the server may have restarted)
+    response.clear();
+    if (serverSocket < 0) serverSocket = openConnection(serverPath);
+    if (serverSocket < 0) return FerryStatus::SERVER_UNAVAILABLE;
+
+    FrameHeader header;
+    if (!sendFrame(serverSocket, op, FerryStatus::OK, request, length) ||
+        !receiveFrame(serverSocket, header, response) ||
+        header.op != static_cast<uint16_t>(op))
+    {
+        ::close(serverSocket);  // The stream is out of step; do not reuse it
+        serverSocket = -1;
+        response.clear();
+        return FerryStatus::SERVER_UNAVAILABLE;
+    }
+    return static_cast<FerryStatus>(header.status);
+}
+
+//-----------------------------------------------
+KeyRequest makeKeyRequest(const char *key)
+{
+    KeyRequest request;
+    copyKey(request.key, sizeof(request.key), key);
+    return request;
+}
+
+//-----------------------------------------------
+const char *ferryStatusMessage(FerryStatus status)
+{
+    switch (status)
+    {
+        case FerryStatus::OK:                  return "Success";
+        case FerryStatus::NOT_FOUND:           return "Record not found";
+        case FerryStatus::VESSEL_NOT_FOUND:    return "Vessel not found";
+        case FerryStatus::VEHICLE_NOT_FOUND:   return "License plate not in system";
+        case FerryStatus::SAILING_NOT_FOUND:   return "Sailing not found";
+        case FerryStatus::ALREADY_EXISTS:      return "Record already exists";
+        case FerryStatus::ALREADY_ONBOARD:     return "Customer already checked-in";
+        case FerryStatus::NO_CAPACITY:         return "Remaining capacity is not enough for vehicle size";
+        case FerryStatus::RESERVATIONS_FAILED: return "Failed to delete reservations";
+        case FerryStatus::STORAGE_FAILED:      return "Storage operation failed";
+        case FerryStatus::BAD_REQUEST:         return "Invalid request";
+        case FerryStatus::SERVER_UNAVAILABLE:  return "Ferry server unavailable";
+    }
+    return "Unknown error";
+}
@@ -0,0 +1,85 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: FerryClient.h
+/*
+    Module: FerryClient.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the client side of the request protocol. The menu
+        screens send every operation through callFerry(): when a server
+        connection is open the request travels over the socket, otherwise it
+        runs in-process against the local storage modules. The screens are
+        the same either way.
+*/
+
+#ifndef FERRY_CLIENT_H
+#define FERRY_CLIENT_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "FerryProtocol.h"
+
+//-----------------------------------------------
+bool connectFerryServer(
+    const std::string &socketPath  // in: server socket
+);
+// Opens the connection later calls go through. Returns false (with a
+// message on cerr) if no server is listening there.
+
+//-----------------------------------------------
+void disconnectFerryServer();
+// Closes the connection; later calls run in-process again.
+
+//-----------------------------------------------
+FerryStatus callFerry(
+    FerryOp op,                   // in: operation
+    const void *request,          // in: request payload
+    std::size_t length,           // in: payload size in bytes
+    std::vector<char> &response   // out: response payload
+);
+// Runs one request and returns its status. SERVER_UNAVAILABLE if the
+// server cannot be reached; the next call reconnects.
+
+//-----------------------------------------------
+template <typename Request, typename Response>
+FerryStatus callFerry(
+    FerryOp op,                 // in: operation
+    const Request &request,     // in: fixed-size request
+    Response &result            // out: fixed-size response (set on OK)
+)
+{
+    std::vector<char> response;
+    FerryStatus status = callFerry(op, &request, sizeof(Request), response);
+    if (status != FerryStatus::OK) return status;
+    if (response.size() != sizeof(Response)) return FerryStatus::BAD_REQUEST;
+    std::memcpy(&result, response.data(), sizeof(Response));
+    return status;
+}
+// Typed form for operations with one fixed-size response.
+
+//-----------------------------------------------
+template <typename Request>
+FerryStatus callFerry(
+    FerryOp op,                 // in: operation
+    const Request &request      // in: fixed-size request
+)
+{
+    std::vector<char> response;
+    return callFerry(op, &request, sizeof(Request), response);
+}
+// Typed form for operations without a response payload.
+
+//-----------------------------------------------
+KeyRequest makeKeyRequest(
+    const char *key   // in: vessel name, plate, sailing ID or reservation ID
+);
+
+//-----------------------------------------------
+const char *ferryStatusMessage(
+    FerryStatus status  // in: status a screen has no specific message for
+);
+// Generic error text, e.g. for SERVER_UNAVAILABLE.
+
+#endif // FERRY_CLIENT_H
@@ -0,0 +1,103 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: FerryProtocol.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Frame I/O for the client/server protocol: whole-buffer reads and
+        writes over a stream socket, retried across short transfers and
+        signal interruptions.
+*/
+
+//============================================
+
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "FerryProtocol.h"
+
+//-----------------------------------------------
+// helper: write all of buffer, or fail
+static bool writeFully(int fd, const char *buffer, std::size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = ::send(fd, buffer, length, MSG_NOSIGNAL);  // No SIGPIPE if the peer left
+        if (written < 0)
+        {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        buffer += written;
+        length -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+//-----------------------------------------------
+// helper: read exactly length bytes, or fail (end of stream included)
+static bool readFully(int fd, char *buffer, std::size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t got = ::recv(fd, buffer, length, 0);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) return false;
+        buffer += got;
+        length -= static_cast<std::size_t>(got);
+    }
+    return true;
+}
+
+//-----------------------------------------------
+bool sendFrame(int fd, FerryOp op, FerryStatus status, const void *payload, std::size_t length)
+{
+    if (length > FERRY_MAX_PAYLOAD) return false;
+
+    // Header and payload go out in one buffer: one send, one packet
+    std::vector<char> frame(sizeof(FrameHeader) + length);
+    FrameHeader header{static_cast<std::uint32_t>(length), static_cast<std::uint16_t>(op),
+                       static_cast<std::uint16_t>(status)};
+    std::memcpy(frame.data(), &header, sizeof(header));
+    if (length > 0) std::memcpy(frame.data() + sizeof(header), payload, length);
+    return writeFully(fd, frame.data(), frame.size());
+}
+
+//-----------------------------------------------
+bool receiveFrame(int fd, FrameHeader &header, std::vector<char> &payload)
+{
+    if (!readFully(fd, reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (header.length > FERRY_MAX_PAYLOAD) return false;
+
+    payload.resize(header.length);
+    return header.length == 0 || readFully(fd, payload.data(), header.length);
+}
+
+//-----------------------------------------------
+const char *ferryStatusName(FerryStatus status)
+{
+    switch (status)
+    {
+        case FerryStatus::OK:                  return "OK";
+        case FerryStatus::NOT_FOUND:           return "NOT_FOUND";
+        case FerryStatus::VESSEL_NOT_FOUND:    return "VESSEL_NOT_FOUND";
+        case FerryStatus::VEHICLE_NOT_FOUND:   return "VEHICLE_NOT_FOUND";
+        case FerryStatus::SAILING_NOT_FOUND:   return "SAILING_NOT_FOUND";
+        case FerryStatus::ALREADY_EXISTS:      return "ALREADY_EXISTS";
+        case FerryStatus::ALREADY_ONBOARD:     return "ALREADY_ONBOARD";
+        case FerryStatus::NO_CAPACITY:         return "NO_CAPACITY";
+        case FerryStatus::RESERVATIONS_FAILED: return "RESERVATIONS_FAILED";
+        case FerryStatus::STORAGE_FAILED:      return "STORAGE_FAILED";
+        case FerryStatus::BAD_REQUEST:         return "BAD_REQUEST";
+        case FerryStatus::SERVER_UNAVAILABLE:  return "SERVER_UNAVAILABLE";
+    }
+    return "UNKNOWN";
+}
+
+//-----------------------------------------------
+void copyKey(char *dest, std::size_t size, const char *source)
+{
+    std::memset(dest, 0, size);
+    std::strncpy(dest, source, size - 1);
+}
@@ -0,0 +1,200 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: FerryProtocol.h
+/*
+    Module: FerryProtocol.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Binary request protocol spoken between clerk clients and the ferry
+        server over a local Unix domain socket. Every message is one frame:
+        an 8-byte header (payload length, operation, status) followed by the
+        payload, which is one of the fixed-size structs below, optionally
+        followed by an array of fixed-size entries. Both ends run on the same
+        host, so structs travel in native byte order and layout.
+*/
+
+#ifndef FERRY_PROTOCOL_H
+#define FERRY_PROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Reservation.h"
+#include "Sailing.h"
+#include "Vehicle.h"
+#include "Vessel.h"
+
+//-----------------------------------------------
+// Constants
+static constexpr const char *FERRY_DEFAULT_SOCKET = "ferry.sock";  // created in the data directory
+static constexpr std::uint32_t FERRY_MAX_PAYLOAD = 1 << 20;        // frames above 1 MiB are rejected
+static constexpr std::uint32_t FERRY_REPORT_PAGE_ROWS = 5;         // sailings per report page
+
+//-----------------------------------------------
+// Operations a client can request
+enum class FerryOp : std::uint16_t
+{
+    VESSEL_CREATE = 1,            // Vessel                      -> (none)
+    VESSEL_GET,                   // KeyRequest (name)           -> Vessel
+    VEHICLE_GET,                  // KeyRequest (plate)          -> Vehicle
+    SAILING_CREATE,               // SailingCreateRequest        -> (none)
+    SAILING_DELETE,               // KeyRequest (sailing ID)     -> (none)
+    SAILING_GET,                  // KeyRequest (sailing ID)     -> SailingRow
+    SAILING_REPORT,               // SailingReportRequest        -> SailingReportHeader + SailingRow[count]
+    RESERVATION_GET,              // KeyRequest (reservation ID) -> Reservation
+    RESERVATION_CREATE,           // ReservationCreateRequest    -> ReservationCreateResponse
+    RESERVATION_CANCEL,           // ReservationKeyRequest       -> (none)
+    RESERVATION_CHECK_IN,         // ReservationKeyRequest       -> CheckInResponse
+    RESERVATION_CHECK_IN_BATCH,   // BatchCheckInHeader + plate[count] -> BatchCheckInResult[count]
+    SAILING_PREPARE,              // KeyRequest (sailing ID)     -> PrepareSailingResponse
+    SAILING_DEPART                // KeyRequest (sailing ID)     -> (none)
+};
+
+//-----------------------------------------------
+// Outcome of a request (header status of a response frame)
+enum class FerryStatus : std::uint16_t
+{
+    OK = 0,
+    NOT_FOUND,             // the record named by the request does not exist
+    VESSEL_NOT_FOUND,
+    VEHICLE_NOT_FOUND,
+    SAILING_NOT_FOUND,
+    ALREADY_EXISTS,        // vessel name, sailing ID or reservation already taken
+    ALREADY_ONBOARD,       // reservation is checked in
+    NO_CAPACITY,           // no lane has room for the vehicle
+    RESERVATIONS_FAILED,   // a sailing's reservations could not be removed
+    STORAGE_FAILED,        // the storage modules rejected the change
+    BAD_REQUEST,           // unknown operation or malformed payload
+    SERVER_UNAVAILABLE     // client side: the server could not be reached
+};
+
+//-----------------------------------------------
+// Struct:  FrameHeader
+// Purpose: Precedes every request and response payload.
+struct FrameHeader
+{
+    std::uint32_t length;  // payload bytes after the header
+    std::uint16_t op;      // FerryOp
+    std::uint16_t status;  // FerryStatus (0 in requests)
+};
+
+//-----------------------------------------------
+// Payloads
+struct KeyRequest
+{
+    char key[VESSEL_NAME_LEN];  // vessel name, plate, sailing ID or reservation ID (null-terminated)
+};
+
+struct SailingCreateRequest
+{
+    char vesselName[VESSEL_NAME_LEN];
+    char sailingID[sizeof(Sailing::id)];
+};
+
+struct SailingRow
+{
+    Sailing sailing;
+    std::int32_t vehicleCount;  // TV
+    float capacityFactor;       // CF (%)
+};
+
+struct SailingReportRequest
+{
+    std::uint32_t offset;   // first row, newest sailing first
+    std::uint32_t maxRows;
+};
+
+struct SailingReportHeader
+{
+    std::uint32_t total;    // sailings in the system
+    std::uint32_t count;    // rows that follow
+};
+
+struct ReservationCreateRequest
+{
+    char licensePlate[sizeof(Reservation::licensePlate)];
+    char sailingID[sizeof(Reservation::sailingID)];
+    std::uint8_t registered;  // 1: take dimensions and phone from the vehicle record
+    std::int32_t vehicleLength;  // unregistered vehicles only (centimetres)
+    std::int32_t vehicleHeight;  // unregistered vehicles only (centimetres)
+    char phone[sizeof(Reservation::phone)];
+};
+
+struct ReservationCreateResponse
+{
+    Lane lane;                  // lane the vehicle was assigned
+    std::uint8_t vehicleSaved;  // unregistered vehicles: 1 if added to the vehicle file
+};
+
+struct ReservationKeyRequest
+{
+    char licensePlate[sizeof(Reservation::licensePlate)];
+    char sailingID[sizeof(Reservation::sailingID)];
+};
+
+struct CheckInResponse
+{
+    double fare;  // amount to collect
+};
+
+struct BatchCheckInHeader
+{
+    char sailingID[sizeof(Reservation::sailingID)];
+    std::uint32_t count;  // plates that follow, each char[sizeof(Reservation::licensePlate)]
+};
+
+struct BatchCheckInResult
+{
+    std::uint16_t status;  // FerryStatus for this plate
+    double fare;           // amount to collect when status is OK
+};
+
+// Most plates one RESERVATION_CHECK_IN_BATCH may carry: the request (11
+// bytes per plate) and its results (16 bytes per plate) must each fit in
+// one frame
+static constexpr std::uint32_t FERRY_MAX_BATCH_PLATES =
+    (FERRY_MAX_PAYLOAD - sizeof(BatchCheckInHeader)) / sizeof(Reservation::licensePlate) <
+            FERRY_MAX_PAYLOAD / sizeof(BatchCheckInResult)
+        ? (FERRY_MAX_PAYLOAD - sizeof(BatchCheckInHeader)) / sizeof(Reservation::licensePlate)
+        : FERRY_MAX_PAYLOAD / sizeof(BatchCheckInResult);
+
+struct PrepareSailingResponse
+{
+    std::uint32_t reservations;  // reservations loaded for check-in
+};
+
+//-----------------------------------------------
+bool sendFrame(
+    int fd,                  // in: connected socket
+    FerryOp op,              // in: operation
+    FerryStatus status,      // in: status (FerryStatus::OK for requests)
+    const void *payload,     // in: payload bytes (may be null when length is 0)
+    std::size_t length       // in: payload size in bytes
+);
+// Writes one complete frame. Returns false if the peer has gone away.
+
+//-----------------------------------------------
+bool receiveFrame(
+    int fd,                       // in: connected socket
+    FrameHeader &header,          // out: frame header
+    std::vector<char> &payload    // out: payload bytes
+);
+// Reads one complete frame. Returns false on end of stream, a read error
+// or a payload larger than FERRY_MAX_PAYLOAD.
+
+//-----------------------------------------------
+const char *ferryStatusName(
+    FerryStatus status  // in: status
+);
+// Stable upper-case name of a status ("OK", "NOT_FOUND", ...) for logs and
+// machine-readable output.
+
+//-----------------------------------------------
+void copyKey(
+    char *dest,              // out: fixed-size field
+    std::size_t size,        // in: size of the field in bytes
+    const char *source       // in: null-terminated text
+);
+// Zero-fills the field and copies at most size - 1 characters into it.
+
+#endif // FERRY_PROTOCOL_H
@@ -0,0 +1,253 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: FerryServer.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the multi-clerk server.
+
+        Threads: the calling thread accepts connections and polls every
+        idle one; a connection with a request waiting is queued for a fixed
+        pool of workers. A worker answers that one request and hands the
+        connection back to the poll loop (through a wake-up pipe), so any
+        number of clerks can stay connected while the pool bounds how many
+        requests run at once. Requests from different connections run in
+        parallel (see RequestHandlers.cpp).
+        Shutdown: SIGINT/SIGTERM set a flag the poll loop checks; connections
+        being served are shut down so blocked workers wake, every worker is
+        joined, and the remaining connections are closed before returning.
+*/
+
+//============================================
+
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "FerryServer.h"
+#include "FerryProtocol.h"
+#include "RequestHandlers.h"
+
+using namespace std;
+
+//============================================
+
+static const int ACCEPT_POLL_MS = 200;         // how often the poll loop checks for a stop signal
+
+static volatile sig_atomic_t stopRequested = 0;
+static atomic<bool> stopping{false};
+static mutex queueMutex;                        // Guards the three connection lists below
+static condition_variable queueReady;
+static deque<int> pendingConnections;           // a request is waiting; not yet taken by a worker
+static set<int> openConnections;                // taken by a worker
+static deque<int> returnedConnections;          // answered; waiting to be polled again
+static int wakePipe[2] = {-1, -1};              // a worker writes a byte after returning a connection
+
+//-----------------------------------------------
+// helper: signal handler; only sets the flag
+static void onStopSignal(int)
+{
+    stopRequested = 1;
+}
+
+//-----------------------------------------------
+// helper: answer the request waiting on a connection; false once the
+// connection has closed (or broke) and should be dropped
+static bool serveRequest(int fd)
+{
+    FrameHeader header;
+    vector<char> request;
+    vector<char> response;
+    if (stopping || !receiveFrame(fd, header, request)) return false;
+
+    FerryOp op = static_cast<FerryOp>(header.op);
+    FerryStatus status = handleFerryRequest(op, request.data(), request.size(), response);
+    return sendFrame(fd, op, status, response.data(), response.size());
+}
+
+//-----------------------------------------------
+// helper: have the poll loop pick up returned connections now rather than
+// at its next timeout
+static void wakePollLoop()
+{
+    const char wake = 0;
+    while (::write(wakePipe[1], &wake, 1) < 0 && errno == EINTR)
+    {
+    }
+}
+
+//-----------------------------------------------
+// helper: worker thread body
+static void workerLoop()
+{
+    while (true)
+    {
+        int fd;
+        {
+            unique_lock<mutex> lock(queueMutex);
+            queueReady.wait(lock, [] { return stopping || !pendingConnections.empty(); });
+            if (stopping) return;
+            fd = pendingConnections.front();
+            pendingConnections.pop_front();
+            openConnections.insert(fd);
+        }
+
+        bool keep = serveRequest(fd);
+
+        {
+            lock_guard<mutex> lock(queueMutex);
+            openConnections.erase(fd);
+            if (keep && !stopping) returnedConnections.push_back(fd);
+            else keep = false;
+        }
+        if (!keep)
+        {
+            ::close(fd);
+            continue;
+        }
+        wakePollLoop();
+    }
+}
+
+//-----------------------------------------------
+// helper: bound, listening socket at socketPath, or -1
+static int openListeningSocket(const string &socketPath)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        cerr << "Error: Socket path " << socketPath << " is too long." << endl;
+        return -1;
+    }
+    copyKey(address.sun_path, sizeof(address.sun_path), socketPath.c_str());
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        cerr << "Error: Failed to create server socket." << endl;
+        return -1;
+    }
+
+    ::unlink(socketPath.c_str());  // A previous server that did not exit cleanly leaves its socket behind
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(fd, SOMAXCONN) != 0)
+    {
+        cerr << "Error: Failed to listen on " << socketPath << "." << endl;
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+//-----------------------------------------------
+bool runFerryServer(const string &socketPath, unsigned workerCount)
+{
+    int listenSocket = openListeningSocket(socketPath);
+    if (listenSocket < 0) return false;
+
+    // Stop on Ctrl-C or kill; no SA_RESTART, so poll() returns early
+    struct sigaction action{};
+    action.sa_handler = onStopSignal;
+    sigemptyset(&action.sa_mask);
+    struct sigaction previousInt, previousTerm;
+    sigaction(SIGINT, &action, &previousInt);
+    sigaction(SIGTERM, &action, &previousTerm);
+    stopRequested = 0;
+    stopping = false;
+
+    if (::pipe(wakePipe) != 0)
+    {
+        cerr << "Error: Failed to create the server wake-up pipe." << endl;
+        ::close(listenSocket);
+        ::unlink(socketPath.c_str());
+        return false;
+    }
+
+    vector<thread> workers;
+    for (unsigned i = 0; i < max(workerCount, 1u); ++i)
+    {
+        workers.emplace_back(workerLoop);
+    }
+    cout << "Ferry server listening on " << socketPath << " with " << workers.size() << " workers" << endl;
+
+    vector<int> idleConnections;  // connected clerks with no request being served; owned by this thread
+    vector<pollfd> waitFor;
+    while (!stopRequested)  // Loop goal: queue every connection that has a request waiting
+    {
+        waitFor.assign({pollfd{listenSocket, POLLIN, 0}, pollfd{wakePipe[0], POLLIN, 0}});
+        for (int fd : idleConnections) waitFor.push_back(pollfd{fd, POLLIN, 0});
+        if (::poll(waitFor.data(), waitFor.size(), ACCEPT_POLL_MS) < 0) continue;  // Signal
+
+        // Connections with a request (or a hang-up, which the worker sees as end of stream)
+        vector<int> stillIdle;
+        bool queued = false;
+        {
+            lock_guard<mutex> lock(queueMutex);
+            for (size_t i = 2; i < waitFor.size(); ++i)
+            {
+                if (waitFor[i].revents != 0)
+                {
+                    pendingConnections.push_back(waitFor[i].fd);
+                    queued = true;
+                }
+                else
+                {
+                    stillIdle.push_back(waitFor[i].fd);
+                }
+            }
+            stillIdle.insert(stillIdle.end(), returnedConnections.begin(), returnedConnections.end());
+            returnedConnections.clear();
+        }
+        if (queued) queueReady.notify_all();
+        idleConnections.swap(stillIdle);
+
+        if (waitFor[1].revents != 0)  // Drain the wake-ups; the returned connections were taken above
+        {
+            char drain[64];
+            while (::read(wakePipe[0], drain, sizeof(drain)) < 0 && errno == EINTR)
+            {
+            }
+        }
+        if (waitFor[0].revents != 0)
+        {
+            int clientSocket = ::accept(listenSocket, nullptr, nullptr);
+            if (clientSocket >= 0) idleConnections.push_back(clientSocket);
+        }
+    }
+
+    // Stop accepting, wake every worker and unblock the ones mid-read
+    ::close(listenSocket);
+    ::unlink(socketPath.c_str());
+    {
+        lock_guard<mutex> lock(queueMutex);
+        stopping = true;
+        for (int fd : openConnections) ::shutdown(fd, SHUT_RDWR);
+    }
+    queueReady.notify_all();
+    for (thread &worker : workers) worker.join();
+
+    // Every worker has finished: close what is left
+    for (int fd : pendingConnections) ::close(fd);
+    for (int fd : returnedConnections) ::close(fd);
+    for (int fd : idleConnections) ::close(fd);
+    pendingConnections.clear();
+    returnedConnections.clear();
+    ::close(wakePipe[0]);
+    ::close(wakePipe[1]);
+    wakePipe[0] = wakePipe[1] = -1;
+
+    sigaction(SIGINT, &previousInt, nullptr);
+    sigaction(SIGTERM, &previousTerm, nullptr);
+    cout << "Ferry server stopped" << endl;
+    return true;
+}
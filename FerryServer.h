@@ -0,0 +1,29 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: FerryServer.h
+/*
+    Module: FerryServer.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the multi-clerk server: one process owns the storage
+        modules and serves clerk clients over a local Unix domain socket.
+*/
+
+#ifndef FERRY_SERVER_H
+#define FERRY_SERVER_H
+
+#include <string>
+
+static constexpr unsigned FERRY_DEFAULT_WORKERS = 4;  // requests served concurrently
+
+//-----------------------------------------------
+bool runFerryServer(
+    const std::string &socketPath,  // in: socket to listen on (replaced if stale)
+    unsigned workerCount            // in: worker threads, one request each at a time
+);
+// Serves requests until SIGINT or SIGTERM, then closes every connection and
+// returns true. Returns false if the socket cannot be created. Storage must
+// have been started (startup()) and is left open for the caller to shut down.
+// Any number of clerks may stay connected; their requests share the workers.
+
+#endif // FERRY_SERVER_H
@@ -0,0 +1,207 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: FixedString.h
+/*
+    Module: FixedString.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Fixed-width key type for the char[N] ID fields of the record structs
+        (Sailing::id, Vessel::name, Vehicle::licensePlate).
+        A FixedString holds the key zero-padded to N bytes together with a
+        byte mask covering the bytes strncmp(field, key, N) would look at, so
+        matching a record field is a masked compare of whole registers
+        instead of a byte loop. Bytes after a field's terminating null are
+        never examined, which keeps the old strncmp semantics for records
+        whose unused bytes are not zeroed.
+
+        Kernels: AVX2 (two records per iteration in findIn), SSE2, and a
+        64-bit word compare (byte loop below 8 bytes) for other targets.
+*/
+
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+//-----------------------------------------------
+// Class:   FixedString
+// in:      N – width of the char array field being matched
+// Purpose: Search key for char[N] fields. matches() is equivalent to
+//          strncmp(field, key, N) == 0; findIn() runs that test over the
+//          key fields of a contiguous block of records.
+template <std::size_t N>
+class FixedString
+{
+    static_assert(N > 0, "FixedString needs a non-empty field");
+
+public:
+    //-----------------------------------------------
+    FixedString() { assign(""); }
+
+    //-----------------------------------------------
+    explicit FixedString(
+        const char *key  // in: null-terminated key; only the first N characters count
+    )
+    {
+        assign(key);
+    }
+
+    //-----------------------------------------------
+    void assign(const char *key)
+    {
+        std::memset(bytes, 0, sizeof(bytes));
+        std::memset(mask, 0, sizeof(mask));
+        length = strnlen(key, N);
+        std::memcpy(bytes, key, length);
+
+        // strncmp stops after the key's null or after N bytes
+        std::size_t compared = length < N ? length + 1 : N;
+        std::memset(mask, 0xFF, compared);
+    }
+
+    //-----------------------------------------------
+    const char *data() const { return bytes; }
+    // Zero-padded key bytes (not null-terminated when size() == N).
+
+    //-----------------------------------------------
+    std::size_t size() const { return length; }
+    // Characters before the padding.
+
+    //-----------------------------------------------
+    bool operator==(const FixedString &other) const { return std::memcmp(bytes, other.bytes, N) == 0; }
+    bool operator!=(const FixedString &other) const { return !(*this == other); }
+
+    //-----------------------------------------------
+    std::uint64_t hash() const
+    {
+        // Word-at-a-time multiply/xor-shift over the padded bytes
+        std::uint64_t h = 0x9E3779B97F4A7C15ull ^ N;
+        for (std::size_t i = 0; i < PADDED; i += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + i, 8);
+            h = (h ^ word) * 0xFF51AFD7ED558CCDull;
+            h ^= h >> 32;
+        }
+        return h;
+    }
+    // Equal keys (as strncmp over N bytes sees them) hash equally.
+
+    //-----------------------------------------------
+    bool matches(
+        const char *field  // in: start of a char[N] field
+    ) const
+    {
+#if defined(__SSE2__)
+        if constexpr (N >= 16 && N <= 32)
+        {
+            // Two overlapping 16-byte loads cover a 16..32 byte field without reading past it
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(field));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(field + N - 16));
+            __m128i diff = _mm_or_si128(
+                _mm_and_si128(_mm_xor_si128(lo, keyVector(0)), maskVector(0)),
+                _mm_and_si128(_mm_xor_si128(hi, keyVector(N - 16)), maskVector(N - 16)));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128())) == 0xFFFF;
+        }
+#endif
+        if constexpr (N >= 8)
+        {
+            // 64-bit words, the last one overlapping so no byte past the field is read
+            std::uint64_t diff = 0;
+            for (std::size_t offset = 0; offset + 8 < N; offset += 8)
+            {
+                diff |= (fieldWord(field, offset) ^ keyWord(offset)) & maskWord(offset);
+            }
+            diff |= (fieldWord(field, N - 8) ^ keyWord(N - 8)) & maskWord(N - 8);
+            return diff == 0;
+        }
+        else
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if ((field[i] ^ bytes[i]) & mask[i]) return false;
+            }
+            return true;
+        }
+    }
+    // True if strncmp(field, key, N) == 0.
+
+    //-----------------------------------------------
+    long findIn(
+        const char *firstField,  // in: key field of the first record
+        std::size_t stride,      // in: bytes from one record's field to the next (sizeof the record)
+        std::size_t count        // in: records in the block
+    ) const
+    {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        if constexpr (N >= 16 && N <= 32)
+        {
+            // Two records per iteration: record i in the low lane, i+1 in the high lane
+            const __m256i keyLo = _mm256_broadcastsi128_si256(keyVector(0));
+            const __m256i keyHi = _mm256_broadcastsi128_si256(keyVector(N - 16));
+            const __m256i maskLo = _mm256_broadcastsi128_si256(maskVector(0));
+            const __m256i maskHi = _mm256_broadcastsi128_si256(maskVector(N - 16));
+            for (; i + 2 <= count; i += 2)
+            {
+                const char *a = firstField + i * stride;
+                const char *b = a + stride;
+                __m256i lo = _mm256_set_m128i(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b)),
+                                              _mm_loadu_si128(reinterpret_cast<const __m128i*>(a)));
+                __m256i hi = _mm256_set_m128i(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + N - 16)),
+                                              _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + N - 16)));
+                __m256i diff = _mm256_or_si256(_mm256_and_si256(_mm256_xor_si256(lo, keyLo), maskLo),
+                                               _mm256_and_si256(_mm256_xor_si256(hi, keyHi), maskHi));
+                std::uint32_t equal = static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(diff, _mm256_setzero_si256())));
+                if ((equal & 0xFFFFu) == 0xFFFFu) return static_cast<long>(i);
+                if ((equal >> 16) == 0xFFFFu) return static_cast<long>(i + 1);
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            if (matches(firstField + i * stride)) return static_cast<long>(i);
+        }
+        return -1;
+    }
+    // Index of the first record in the block whose field matches, or -1.
+
+private:
+    static constexpr std::size_t PADDED = (N + 15) / 16 * 16;  // whole vectors and words
+
+#if defined(__SSE2__)
+    __m128i keyVector(std::size_t offset) const { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + offset)); }
+    __m128i maskVector(std::size_t offset) const { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + offset)); }
+#endif
+    static std::uint64_t fieldWord(const char *field, std::size_t offset)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, field + offset, 8);
+        return w;
+    }
+    std::uint64_t keyWord(std::size_t offset) const
+    {
+        std::uint64_t w;
+        std::memcpy(&w, bytes + offset, 8);
+        return w;
+    }
+    std::uint64_t maskWord(std::size_t offset) const
+    {
+        std::uint64_t w;
+        std::memcpy(&w, mask + offset, 8);
+        return w;
+    }
+
+    alignas(16) char bytes[PADDED];           // key, zero-padded
+    alignas(16) unsigned char mask[PADDED];   // 0xFF for each byte strncmp would compare
+    std::size_t length = 0;
+};
+
+#endif // FIXED_STRING_H
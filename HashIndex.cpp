@@ -0,0 +1,283 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: HashIndex.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the on-disk open-addressing hash index.
+
+        Data Structure: header followed by a power-of-two array of 16-byte
+                        buckets {plate code, sailing code, slot}
+        Algorithm: ReservationKey hash, linear probing, two-integer key
+                   compare, tombstones on erase,
+                   doubling rehash once used buckets pass 70% of the table;
+                   every bucket and header access is one pread/pwrite at its
+                   own offset
+*/
+
+//============================================
+
+#include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "HashIndex.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr uint32_t INDEX_MAGIC = 0x58444948;      // "HIDX"
+static constexpr uint32_t INDEX_VERSION = 3;              // 3: ReservationKey buckets
+static constexpr uint32_t EMPTY_SLOT = 0xFFFFFFFF;       // bucket never used
+static constexpr uint32_t TOMBSTONE_SLOT = 0xFFFFFFFE;   // bucket freed by erase
+static constexpr uint32_t MIN_BUCKETS = 1024;
+static constexpr double MAX_LOAD = 0.7;
+
+//-----------------------------------------------
+// helper: bucket hash of a key
+static uint32_t hashKey(const ReservationKey &key)
+{
+    return static_cast<uint32_t>(key.hash());
+}
+
+//-----------------------------------------------
+// helper: smallest power of two able to hold entries under the load limit
+static uint32_t bucketsFor(uint32_t entries)
+{
+    uint32_t buckets = MIN_BUCKETS;
+    while (buckets * MAX_LOAD < entries + 1)
+    {
+        buckets <<= 1;
+    }
+    return buckets;
+}
+
+//-----------------------------------------------
+// helper: read or write exactly length bytes at offset
+static bool readAt(int fd, void *data, size_t length, off_t offset)
+{
+    return pread(fd, data, length, offset) == static_cast<ssize_t>(length);
+}
+
+static bool writeAt(int fd, const void *data, size_t length, off_t offset)
+{
+    return pwrite(fd, data, length, offset) == static_cast<ssize_t>(length);
+}
+
+//-----------------------------------------------
+bool HashIndex::open(const string &path, uint64_t dataFileSize)
+{
+    filePath = path;
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);  // Index missing: created empty
+    if (fd < 0)
+    {
+        cerr << "Error: Failed to create index file " << path << "." << endl;
+        return false;
+    }
+
+    if (!readAt(fd, &header, sizeof(Header), 0))
+    {
+        return false;  // Empty or truncated index
+    }
+
+    bool usable = header.magic == INDEX_MAGIC &&
+                  header.version == INDEX_VERSION &&
+                  header.clean == 1 &&
+                  header.dataFileSize == dataFileSize;
+    if (!usable) return false;
+
+    // Mark the index as in use so a crash before close() forces a rebuild
+    header.clean = 0;
+    return writeHeader();
+}
+
+//-----------------------------------------------
+void HashIndex::close(uint64_t dataFileSize)
+{
+    if (fd < 0) return;
+    header.clean = 1;
+    header.dataFileSize = dataFileSize;
+    writeHeader();
+    ::close(fd);
+    fd = -1;
+}
+
+//-----------------------------------------------
+bool HashIndex::rebuild(uint32_t expectedEntries)
+{
+    if (fd < 0) return false;
+
+    header.magic = INDEX_MAGIC;
+    header.version = INDEX_VERSION;
+    header.bucketCount = bucketsFor(expectedEntries);
+    header.liveCount = 0;
+    header.usedCount = 0;
+    header.clean = 0;
+    header.dataFileSize = 0;
+
+    // Rewrite the file as a header followed by all-empty buckets
+    if (ftruncate(fd, 0) != 0 || !writeHeader()) return false;
+
+    Bucket empty{};
+    empty.slot = EMPTY_SLOT;
+    vector<Bucket> block(MIN_BUCKETS, empty);
+    const size_t blockBytes = block.size() * sizeof(Bucket);
+    for (uint32_t written = 0; written < header.bucketCount; written += MIN_BUCKETS)
+    {
+        off_t offset = sizeof(Header) + static_cast<off_t>(written) * sizeof(Bucket);
+        if (!writeAt(fd, block.data(), blockBytes, offset)) return false;
+    }
+    return true;
+}
+
+//-----------------------------------------------
+bool HashIndex::find(const ReservationKey &key, uint32_t &slot) const
+{
+    uint32_t bucketIndex;
+    bool found;
+    if (!probe(key, bucketIndex, found) || !found) return false;
+
+    Bucket b;
+    if (!readBucket(bucketIndex, b)) return false;
+    slot = b.slot;
+    return true;
+}
+
+//-----------------------------------------------
+bool HashIndex::insert(const ReservationKey &key, uint32_t slot)
+{
+    if (fd < 0) return false;
+
+    // Grow before inserting so the probe chain always reaches an empty bucket
+    if (header.usedCount + 1 > header.bucketCount * MAX_LOAD)
+    {
+        if (!resize(header.liveCount * 2 + 1)) return false;
+    }
+
+    uint32_t bucketIndex;
+    bool found;
+    if (!probe(key, bucketIndex, found)) return false;
+    if (found) return true;  // Keep the first record for a duplicate key
+
+    Bucket b;
+    if (!readBucket(bucketIndex, b)) return false;
+    if (b.slot == EMPTY_SLOT) header.usedCount++;  // Reusing a tombstone does not add a used bucket
+
+    b.plate = key.plate;
+    b.sailing = key.sailing;
+    b.slot = slot;
+    header.liveCount++;
+    return writeBucket(bucketIndex, b) && writeHeader();
+}
+
+//-----------------------------------------------
+bool HashIndex::update(const ReservationKey &key, uint32_t slot)
+{
+    uint32_t bucketIndex;
+    bool found;
+    if (!probe(key, bucketIndex, found) || !found) return false;
+
+    Bucket b;
+    if (!readBucket(bucketIndex, b)) return false;
+    b.slot = slot;
+    return writeBucket(bucketIndex, b);
+}
+
+//-----------------------------------------------
+bool HashIndex::erase(const ReservationKey &key)
+{
+    uint32_t bucketIndex;
+    bool found;
+    if (!probe(key, bucketIndex, found) || !found) return false;
+
+    Bucket b;
+    if (!readBucket(bucketIndex, b)) return false;
+    b.slot = TOMBSTONE_SLOT;
+    header.liveCount--;
+    return writeBucket(bucketIndex, b) && writeHeader();
+}
+
+//-----------------------------------------------
+// Walks the probe chain for key. On success bucketIndex is the bucket that
+// holds key (found == true) or the first reusable bucket (found == false).
+bool HashIndex::probe(const ReservationKey &key, uint32_t &bucketIndex, bool &found) const
+{
+    if (fd < 0 || header.bucketCount == 0) return false;
+
+    const uint32_t mask = header.bucketCount - 1;
+    uint32_t index = hashKey(key) & mask;
+    bool haveReusable = false;
+    found = false;
+
+    // Loop goal: stop at the key or at the first never-used bucket
+    for (uint32_t probes = 0; probes < header.bucketCount; ++probes, index = (index + 1) & mask)
+    {
+        Bucket b;
+        if (!readBucket(index, b)) return false;
+
+        if (b.slot == EMPTY_SLOT)
+        {
+            if (!haveReusable) bucketIndex = index;
+            return true;
+        }
+        if (b.slot == TOMBSTONE_SLOT)
+        {
+            if (!haveReusable)
+            {
+                bucketIndex = index;
+                haveReusable = true;
+            }
+            continue;
+        }
+        if (b.plate == key.plate && b.sailing == key.sailing)
+        {
+            bucketIndex = index;
+            found = true;
+            return true;
+        }
+    }
+    return haveReusable;  // Table full of tombstones and live keys
+}
+
+//-----------------------------------------------
+bool HashIndex::readBucket(uint32_t index, Bucket &b) const
+{
+    return readAt(fd, &b, sizeof(Bucket), sizeof(Header) + static_cast<off_t>(index) * sizeof(Bucket));
+}
+
+//-----------------------------------------------
+bool HashIndex::writeBucket(uint32_t index, const Bucket &b)
+{
+    return writeAt(fd, &b, sizeof(Bucket), sizeof(Header) + static_cast<off_t>(index) * sizeof(Bucket));
+}
+
+//-----------------------------------------------
+bool HashIndex::writeHeader()
+{
+    return writeAt(fd, &header, sizeof(Header), 0);
+}
+
+//-----------------------------------------------
+bool HashIndex::resize(uint32_t expectedEntries)
+{
+    // Collect every live entry, then rebuild the table at the new size
+    vector<Bucket> table(header.bucketCount);
+    if (!readAt(fd, table.data(), table.size() * sizeof(Bucket), sizeof(Header))) return false;
+    vector<Bucket> live;
+    live.reserve(header.liveCount);
+    for (const Bucket &b : table)
+    {
+        if (b.slot != EMPTY_SLOT && b.slot != TOMBSTONE_SLOT) live.push_back(b);
+    }
+
+    if (!rebuild(expectedEntries)) return false;
+    for (const auto &entry : live)
+    {
+        ReservationKey key;
+        key.plate = entry.plate;
+        key.sailing = entry.sailing;
+        if (!insert(key, entry.slot)) return false;
+    }
+    return true;
+}
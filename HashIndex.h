@@ -0,0 +1,113 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: HashIndex.h
+/*
+    Module: HashIndex.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of an on-disk open-addressing hash index that maps a
+        ReservationKey (packed plate + sailing code) to the slot number of
+        a record in a fixed-length binary data file.
+*/
+
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "ReservationKey.h"
+
+//-----------------------------------------------
+// Class:   HashIndex
+// Purpose: Linear-probing hash table stored in its own file. Every lookup
+//          costs one positional read per probe; the header remembers the size
+//          of the data file it was built against so a stale index is detected
+//          when the storage module opens it.
+class HashIndex
+{
+public:
+    //-----------------------------------------------
+    bool open(
+        const std::string &path,     // in: index file path
+        std::uint64_t dataFileSize   // in: current size of the indexed data file
+    );
+    // Opens (or creates) the index file.
+    // Returns true if the existing index is usable; false if it is missing,
+    // corrupt, was not shut down cleanly, or was built for a different data
+    // file size. On false the caller must call rebuild() and re-insert.
+
+    //-----------------------------------------------
+    void close(
+        std::uint64_t dataFileSize   // in: final size of the indexed data file
+    );
+    // Marks the index clean, records the data file size and closes the file.
+
+    //-----------------------------------------------
+    bool rebuild(
+        std::uint32_t expectedEntries  // in: number of keys about to be inserted
+    );
+    // Discards every entry and sizes the table for expectedEntries keys.
+
+    //-----------------------------------------------
+    bool find(
+        const ReservationKey &key,   // in: key to look up
+        std::uint32_t &slot          // out: record slot if found
+    ) const;
+    // Returns true and sets slot if key is present.
+
+    //-----------------------------------------------
+    bool insert(
+        const ReservationKey &key,   // in: key to add
+        std::uint32_t slot           // in: record slot of key
+    );
+    // Adds key -> slot. If key is already present the existing entry is kept.
+    // Grows the table when the load factor passes the limit.
+
+    //-----------------------------------------------
+    bool update(
+        const ReservationKey &key,   // in: existing key
+        std::uint32_t slot           // in: new record slot
+    );
+    // Repoints an existing key at a different slot (used when a record moves).
+
+    //-----------------------------------------------
+    bool erase(
+        const ReservationKey &key    // in: key to remove
+    );
+    // Removes key, leaving a tombstone so later probe chains stay intact.
+
+    //-----------------------------------------------
+    bool isOpen() const { return fd >= 0; }
+
+private:
+    struct Header
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t bucketCount;   // always a power of two
+        std::uint32_t liveCount;     // buckets holding a key
+        std::uint32_t usedCount;     // live + tombstone buckets
+        std::uint32_t clean;         // 1 if closed cleanly, 0 while open
+        std::uint64_t dataFileSize;  // size of data file the index describes
+    };
+
+    struct Bucket
+    {
+        std::uint64_t plate;         // ReservationKey, stored field by field
+        std::uint32_t sailing;
+        std::uint32_t slot;          // EMPTY_SLOT, TOMBSTONE_SLOT or record slot
+    };
+
+    bool probe(const ReservationKey &key, std::uint32_t &bucketIndex, bool &found) const;
+    bool readBucket(std::uint32_t index, Bucket &b) const;
+    bool writeBucket(std::uint32_t index, const Bucket &b);
+    bool writeHeader();
+    bool resize(std::uint32_t expectedEntries);
+
+    int fd = -1;
+    std::string filePath;
+    Header header{};
+};
+
+#endif // HASH_INDEX_H
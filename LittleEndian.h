@@ -0,0 +1,50 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: LittleEndian.h
+/*
+    Module: LittleEndian.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Byte-order helpers for the on-disk formats. Multi-byte fields of
+        packed records and file headers are byte arrays written least
+        significant byte first, so files read the same on any host and the
+        records need no alignment. Compilers turn these loops into single
+        loads and stores on little-endian targets.
+*/
+
+#ifndef LITTLE_ENDIAN_H
+#define LITTLE_ENDIAN_H
+
+#include <cstddef>
+#include <type_traits>
+
+//-----------------------------------------------
+template <typename U>
+inline void storeLittleEndian(
+    unsigned char *field,  // out: sizeof(U) bytes
+    U value                // in: unsigned integer to store
+)
+{
+    static_assert(std::is_unsigned<U>::value, "store unsigned values");
+    for (std::size_t i = 0; i < sizeof(U); ++i)
+    {
+        field[i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+}
+
+//-----------------------------------------------
+template <typename U>
+inline U loadLittleEndian(
+    const unsigned char *field  // in: sizeof(U) bytes
+)
+{
+    static_assert(std::is_unsigned<U>::value, "load unsigned values");
+    U value = 0;
+    for (std::size_t i = 0; i < sizeof(U); ++i)
+    {
+        value |= static_cast<U>(field[i]) << (8 * i);
+    }
+    return value;
+}
+
+#endif // LITTLE_ENDIAN_H
@@ -53,10 +53,12 @@ void showSailingSubMenu()
         std::cout << "\033[94m[1] \033[1;96mCreate New Sailing\n";
         std::cout << "\033[94m[2] \033[1;96mDelete Existing Sailings\n";
         std::cout << "\033[94m[3] \033[1;96mSearch Sailing by ID\n";
+        std::cout << "\033[94m[4] \033[1;96mPrepare Sailing for Check-in\n";
+        std::cout << "\033[94m[5] \033[1;96mMark Sailing Departed\n";
         std::cout << "\033[94m[0] \033[1;96mExit to Main Menu\n";
         std::cout << "\033[94m-------------------------------------------------------------------------------\n";
         
-        int userChoice = getMenuSelection(0, 3);  // validated user selection
+        int userChoice = getMenuSelection(0, 5);  // validated user selection
         
         switch (userChoice)  // Dispatch to appropriate sailing operation
         {
@@ -69,6 +71,12 @@ void showSailingSubMenu()
             case 3:
                 findSailingByID();  // Performs linear search through sailing records
                 break;
+            case 4:
+                prepareSailingForCheckIn();  // Loads the sailing's reservations for check-in
+                break;
+            case 5:
+                departSailing();  // Saves check-ins and unloads the sailing
+                break;
             case 0:
                 exitSubmenu = true;  // Set flag to exit submenu loop
                 break;
@@ -135,6 +143,9 @@ void handleMenuSelection(int choice)
         case 5:
             viewSailingReport();   // Generate and display sailing report
             break;
+        case 6:
+            batchCheckInReservations();  // Check in a queue of vehicles at once
+            break;
         case 0:
             // Exit case: no action needed, handled by caller
             break;
@@ -151,7 +162,7 @@ void runMainMenu()
     while (!programExit)  // Loop goal: run main menu until user chooses to quit
     {
         showMainMenu();                    // Display menu options to user
-        int userSelection = getMenuSelection(0, 5);  // Get validated menu choice
+        int userSelection = getMenuSelection(0, 6);  // Get validated menu choice
         
         if (userSelection == 0)  // Check for exit condition
             programExit = true;
@@ -172,6 +183,7 @@ void showMainMenu()
     std::cout << "\033[94m[3] \033[96mManage Reservations\n"; // Blue digits/brackets, cyan text
     std::cout << "\033[94m[4] \033[96mCheck-in Vehicle\n";   // Blue digits/brackets, cyan text
     std::cout << "\033[94m[5] \033[96mView Sailing Report\n"; // Blue digits/brackets, cyan text
+    std::cout << "\033[94m[6] \033[96mBatch Check-in\n";     // Blue digits/brackets, cyan text
     std::cout << "\033[94m[0] \033[96mQuit\n";        // Blue digits/brackets, cyan text
     std::cout << "\033[94m-------------------------------------------------------------------------------\n";
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: PartitionDirectory.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the partition directory file.
+
+        Data Structure: header {magic "FPDR", version, count, reserved}
+                        followed by count little-endian uint32 keys
+        Algorithm: the whole file is rewritten on each change (temp file,
+                   fsync, rename, fsync of the parent directory); the
+                   directory is small - one key per partition
+*/
+
+//============================================
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include "LittleEndian.h"
+#include "PartitionDirectory.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr uint32_t DIRECTORY_MAGIC = 0x52445046;  // "FPDR"
+static constexpr uint32_t DIRECTORY_VERSION = 1;
+static constexpr size_t DIRECTORY_HEADER_BYTES = 16;
+
+//-----------------------------------------------
+// helper: fsync the directory holding path, so a rename in it is durable
+static void syncParentDirectory(const string &path)
+{
+    size_t slash = path.find_last_of('/');
+    string parent = slash == string::npos ? "." : path.substr(0, slash == 0 ? 1 : slash);
+    int fd = ::open(parent.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+    ::close(fd);
+}
+
+//-----------------------------------------------
+bool PartitionDirectory::open(const string &path)
+{
+    filePath = path;
+    entries.clear();
+
+    ifstream in(path, ios::binary);
+    if (!in) return true;  // No partitions yet
+    vector<unsigned char> bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+
+    bool valid = bytes.size() >= DIRECTORY_HEADER_BYTES &&
+                 loadLittleEndian<uint32_t>(bytes.data()) == DIRECTORY_MAGIC &&
+                 loadLittleEndian<uint32_t>(bytes.data() + 4) == DIRECTORY_VERSION;
+    uint32_t count = valid ? loadLittleEndian<uint32_t>(bytes.data() + 8) : 0;
+    if (!valid || bytes.size() != DIRECTORY_HEADER_BYTES + static_cast<size_t>(count) * sizeof(uint32_t))
+    {
+        cerr << "Error: " << path << " is not a valid partition directory." << endl;
+        return false;
+    }
+
+    entries.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        entries.push_back(loadLittleEndian<uint32_t>(bytes.data() + DIRECTORY_HEADER_BYTES + i * sizeof(uint32_t)));
+    }
+    sort(entries.begin(), entries.end());
+    entries.erase(unique(entries.begin(), entries.end()), entries.end());
+    return true;
+}
+
+//-----------------------------------------------
+void PartitionDirectory::close()
+{
+    entries.clear();
+    filePath.clear();
+}
+
+//-----------------------------------------------
+bool PartitionDirectory::contains(uint32_t key) const
+{
+    return binary_search(entries.begin(), entries.end(), key);
+}
+
+//-----------------------------------------------
+bool PartitionDirectory::add(uint32_t key)
+{
+    auto it = lower_bound(entries.begin(), entries.end(), key);
+    if (it != entries.end() && *it == key) return true;
+
+    vector<uint32_t> updated(entries);
+    updated.insert(updated.begin() + (it - entries.begin()), key);
+    if (!write(filePath, updated)) return false;
+    entries.swap(updated);
+    return true;
+}
+
+//-----------------------------------------------
+bool PartitionDirectory::remove(uint32_t key)
+{
+    auto it = lower_bound(entries.begin(), entries.end(), key);
+    if (it == entries.end() || *it != key) return true;
+
+    vector<uint32_t> updated(entries);
+    updated.erase(updated.begin() + (it - entries.begin()));
+    if (!write(filePath, updated)) return false;
+    entries.swap(updated);
+    return true;
+}
+
+//-----------------------------------------------
+bool PartitionDirectory::write(const string &path, const vector<uint32_t> &keys)
+{
+    vector<unsigned char> bytes(DIRECTORY_HEADER_BYTES + keys.size() * sizeof(uint32_t), 0);
+    storeLittleEndian<uint32_t>(bytes.data(), DIRECTORY_MAGIC);
+    storeLittleEndian<uint32_t>(bytes.data() + 4, DIRECTORY_VERSION);
+    storeLittleEndian<uint32_t>(bytes.data() + 8, static_cast<uint32_t>(keys.size()));
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        storeLittleEndian<uint32_t>(bytes.data() + DIRECTORY_HEADER_BYTES + i * sizeof(uint32_t), keys[i]);
+    }
+
+    const string temp = path + ".tmp";
+    int fd = ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    bool ok = ::write(fd, bytes.data(), bytes.size()) == static_cast<ssize_t>(bytes.size()) && fsync(fd) == 0;
+    ::close(fd);
+    if (!ok || rename(temp.c_str(), path.c_str()) != 0)
+    {
+        unlink(temp.c_str());
+        cerr << "Error: Failed to write " << path << "." << endl;
+        return false;
+    }
+    syncParentDirectory(path);
+    return true;
+}
@@ -0,0 +1,72 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: PartitionDirectory.h
+/*
+    Module: PartitionDirectory.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the directory of a partitioned data set (e.g. one
+        reservation file per sailing): the list of partition keys, kept in
+        a small file that is replaced atomically on every change. Writing
+        the directory is the commit point for creating or dropping a
+        partition, so a partition file the directory does not list is left
+        over from a crash and may be deleted.
+*/
+
+#ifndef PARTITION_DIRECTORY_H
+#define PARTITION_DIRECTORY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------
+// Class:   PartitionDirectory
+// Purpose: Sorted set of 32-bit partition keys persisted as a 16-byte
+//          header (magic, version, count) followed by the keys, all
+//          little-endian. Every change rewrites the file to a temp file,
+//          fsyncs it and renames it over the old one.
+class PartitionDirectory
+{
+public:
+    //-----------------------------------------------
+    bool open(
+        const std::string &path  // in: directory file; a missing file is an empty directory
+    );
+    // Returns false if the file exists but is not a valid directory.
+
+    //-----------------------------------------------
+    void close();
+
+    //-----------------------------------------------
+    bool contains(std::uint32_t key) const;
+
+    //-----------------------------------------------
+    const std::vector<std::uint32_t> &keys() const { return entries; }
+    // Partition keys in ascending order.
+
+    //-----------------------------------------------
+    bool add(
+        std::uint32_t key  // in: partition to list
+    );
+    // Durably lists key (no-op if listed). False if the file could not be written.
+
+    //-----------------------------------------------
+    bool remove(
+        std::uint32_t key  // in: partition to drop
+    );
+    // Durably unlists key (no-op if not listed). False if the file could not be written.
+
+    //-----------------------------------------------
+    static bool write(
+        const std::string &path,                 // in: directory file
+        const std::vector<std::uint32_t> &keys   // in: partition keys (any order, no duplicates)
+    );
+    // Writes a directory file durably; used by open() changes and by upgrades.
+
+private:
+    std::string filePath;
+    std::vector<std::uint32_t> entries;  // sorted
+};
+
+#endif // PARTITION_DIRECTORY_H
@@ -0,0 +1,110 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: PerfectHash.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the CHD minimal perfect hash.
+
+        Data Structure: one 32-bit displacement per bucket, ~4 keys per
+                        bucket
+        Algorithm: keys are grouped into buckets by their hash; buckets are
+                   placed largest first, each trying displacements 0, 1,
+                   2, ... until every key of the bucket lands on a free slot
+                   (slot = mix(hash, displacement) mod n)
+*/
+
+//============================================
+
+#include <algorithm>
+#include "PerfectHash.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr size_t KEYS_PER_BUCKET = 4;
+static constexpr uint32_t MAX_DISPLACEMENT = 1u << 20;  // give up (duplicate hashes) past this
+
+//-----------------------------------------------
+// helper: bucket of a key hash
+static size_t bucketOf(uint64_t keyHash, size_t bucketCount)
+{
+    return static_cast<size_t>((keyHash >> 32) % bucketCount);
+}
+
+//-----------------------------------------------
+// helper: slot of a key hash under a displacement (splitmix64 finalizer)
+static size_t slotOf(uint64_t keyHash, uint32_t displacement, size_t keyCount)
+{
+    uint64_t h = keyHash + (static_cast<uint64_t>(displacement) + 1) * 0x9E3779B97F4A7C15ull;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+    h ^= h >> 31;
+    return static_cast<size_t>(h % keyCount);
+}
+
+//-----------------------------------------------
+bool PerfectHash::build(const vector<uint64_t> &keyHashes)
+{
+    clear();
+    size_t n = keyHashes.size();
+    if (n == 0) return true;
+
+    size_t bucketCount = (n + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET;
+    vector<vector<uint64_t>> buckets(bucketCount);
+    for (uint64_t h : keyHashes) buckets[bucketOf(h, bucketCount)].push_back(h);
+
+    // Largest buckets first, while most slots are still free
+    vector<size_t> order(bucketCount);
+    for (size_t b = 0; b < bucketCount; ++b) order[b] = b;
+    stable_sort(order.begin(), order.end(),
+                [&](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+    vector<uint32_t> chosen(bucketCount, 0);
+    vector<bool> taken(n, false);
+    vector<size_t> slots;
+    for (size_t b : order)
+    {
+        const vector<uint64_t> &keys = buckets[b];
+        if (keys.empty()) break;  // Sorted, so the rest are empty too
+
+        // Loop goal: the first displacement that puts every key of the bucket on its own free slot
+        bool placed = false;
+        for (uint32_t d = 0; d < MAX_DISPLACEMENT && !placed; ++d)
+        {
+            slots.clear();
+            placed = true;
+            for (uint64_t h : keys)
+            {
+                size_t s = slotOf(h, d, n);
+                if (taken[s] || find(slots.begin(), slots.end(), s) != slots.end())
+                {
+                    placed = false;
+                    break;
+                }
+                slots.push_back(s);
+            }
+            if (placed) chosen[b] = d;
+        }
+        if (!placed) return false;
+        for (size_t s : slots) taken[s] = true;
+    }
+
+    displacements.swap(chosen);
+    keyCount = n;
+    return true;
+}
+
+//-----------------------------------------------
+size_t PerfectHash::slot(uint64_t keyHash) const
+{
+    return slotOf(keyHash, displacements[bucketOf(keyHash, displacements.size())], keyCount);
+}
+
+//-----------------------------------------------
+void PerfectHash::clear()
+{
+    displacements.clear();
+    keyCount = 0;
+}
@@ -0,0 +1,56 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: PerfectHash.h
+/*
+    Module: PerfectHash.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of a minimal perfect hash over a fixed set of 64-bit key
+        hashes. Built once for a small, rarely changing key set (the vessel
+        catalog); afterwards every key maps to its own slot in [0, n) with
+        one bucket read and one mix, so a lookup is a single probe.
+*/
+
+#ifndef PERFECT_HASH_H
+#define PERFECT_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//-----------------------------------------------
+// Class:   PerfectHash
+// Purpose: CHD (compress, hash, displace) minimal perfect hash. Keys not in
+//          the built set also map to some slot, so the owner must confirm
+//          the key stored there. Immutable after build(); lookups need no
+//          lock of their own.
+class PerfectHash
+{
+public:
+    //-----------------------------------------------
+    bool build(
+        const std::vector<std::uint64_t> &keyHashes  // in: distinct key hashes
+    );
+    // Finds a displacement for every bucket so the keys fill slots 0..n-1
+    // exactly once. Returns false (and leaves the hash empty) if two hashes
+    // are equal or no displacement was found.
+
+    //-----------------------------------------------
+    std::size_t slot(
+        std::uint64_t keyHash  // in: hash of the key
+    ) const;
+    // Slot of a built key; size() must be non-zero.
+
+    //-----------------------------------------------
+    std::size_t size() const { return keyCount; }
+    // Number of keys (and slots).
+
+    //-----------------------------------------------
+    void clear();
+
+private:
+    std::vector<std::uint32_t> displacements;  // one per bucket
+    std::size_t keyCount = 0;
+};
+
+#endif // PERFECT_HASH_H
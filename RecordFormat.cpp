@@ -0,0 +1,303 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: RecordFormat.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the packed record codecs and the compact
+        sailing ID and date encodings.
+*/
+
+//============================================
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include "LittleEndian.h"
+#include "RecordFormat.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr int PACKED_DATE_BASE_YEAR = 2000;
+
+//-----------------------------------------------
+// helper: copy a null-terminated field into a zero-padded packed field;
+// false if the text does not fit
+template <size_t IN, size_t OUT>
+static bool packText(const char (&in)[IN], char (&out)[OUT])
+{
+    size_t length = strnlen(in, IN);
+    if (length > OUT) return false;
+    memset(out, 0, OUT);
+    memcpy(out, in, length);
+    return true;
+}
+
+//-----------------------------------------------
+// helper: copy a zero-padded packed field back into a null-terminated field
+template <size_t IN, size_t OUT>
+static void unpackText(const char (&in)[IN], char (&out)[OUT])
+{
+    static_assert(OUT > IN, "room for the terminator");
+    memset(out, 0, OUT);
+    memcpy(out, in, strnlen(in, IN));
+}
+
+//-----------------------------------------------
+// helper: signed 32-bit field
+static void storeInt32(unsigned char *field, int32_t value)
+{
+    storeLittleEndian<uint32_t>(field, static_cast<uint32_t>(value));
+}
+
+static int32_t loadInt32(const unsigned char *field)
+{
+    return static_cast<int32_t>(loadLittleEndian<uint32_t>(field));
+}
+
+//-----------------------------------------------
+// helper: 6-bit code of a terminal letter: A-Z -> 1..26, a-z -> 27..52, otherwise 0
+static uint32_t terminalCharCode(char c)
+{
+    if (c >= 'A' && c <= 'Z') return static_cast<uint32_t>(c - 'A') + 1;
+    if (c >= 'a' && c <= 'z') return static_cast<uint32_t>(c - 'a') + 27;
+    return 0;
+}
+
+//-----------------------------------------------
+bool encodeSailingID(const char *id, uint32_t &code)
+{
+    if (strnlen(id, sizeof(Sailing::id)) != 9 || id[3] != '-' || id[6] != '-') return false;
+
+    uint32_t terminal = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        uint32_t c = terminalCharCode(id[i]);
+        if (c == 0) return false;
+        terminal = (terminal << 6) | c;
+    }
+    for (int i : {4, 5, 7, 8})
+    {
+        if (!isdigit(static_cast<unsigned char>(id[i]))) return false;
+    }
+    int day = (id[4] - '0') * 10 + (id[5] - '0');
+    int hour = (id[7] - '0') * 10 + (id[8] - '0');
+    if (day < 1 || day > 31 || hour > 23) return false;
+
+    code = (terminal << 10) | static_cast<uint32_t>((day - 1) * 24 + hour);
+    return true;
+}
+
+//-----------------------------------------------
+void decodeSailingID(uint32_t code, char id[10])
+{
+    memset(id, 0, 10);
+    if (code == 0) return;
+
+    uint32_t terminal = code >> 10;
+    for (int i = 2; i >= 0; --i, terminal >>= 6)
+    {
+        uint32_t c = terminal & 63;
+        id[i] = static_cast<char>(c <= 26 ? 'A' + c - 1 : 'a' + c - 27);
+    }
+    uint32_t dayHour = code & 1023;
+    snprintf(id + 3, 7, "-%02u-%02u", dayHour / 24 + 1, dayHour % 24);
+}
+
+//-----------------------------------------------
+static constexpr size_t PLATE_CHARS = 10;
+static constexpr int PLATE_CHAR_BITS = 6;
+
+// helper: 6-bit code of a plate character, in ASCII order; 0 if not allowed
+static uint64_t plateCharCode(char c)
+{
+    if (c == '-') return 1;
+    if (c >= '0' && c <= '9') return static_cast<uint64_t>(c - '0') + 2;
+    if (c >= 'A' && c <= 'Z') return static_cast<uint64_t>(c - 'A') + 12;
+    if (c >= 'a' && c <= 'z') return static_cast<uint64_t>(c - 'a') + 38;
+    return 0;
+}
+
+//-----------------------------------------------
+bool encodePlate(const char *plate, uint64_t &code)
+{
+    size_t length = strnlen(plate, PLATE_CHARS + 1);
+    if (length == 0 || length > PLATE_CHARS) return false;
+
+    code = 0;
+    for (size_t i = 0; i < PLATE_CHARS; ++i)
+    {
+        uint64_t c = i < length ? plateCharCode(plate[i]) : 0;
+        if (i < length && c == 0) return false;
+        code = (code << PLATE_CHAR_BITS) | c;
+    }
+    return true;
+}
+
+//-----------------------------------------------
+void decodePlate(uint64_t code, char plate[11])
+{
+    static const char PLATE_ALPHABET[] = "?-0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    memset(plate, 0, PLATE_CHARS + 1);
+    size_t length = 0;
+    for (int shift = PLATE_CHAR_BITS * (PLATE_CHARS - 1); shift >= 0; shift -= PLATE_CHAR_BITS)
+    {
+        uint64_t c = (code >> shift) & 63;
+        if (c == 0) break;
+        plate[length++] = PLATE_ALPHABET[c];
+    }
+}
+
+//-----------------------------------------------
+bool packDate(const Date &date, uint16_t &packed)
+{
+    if (date.year == 0 && date.month == 0 && date.day == 0)
+    {
+        packed = 0;
+        return true;
+    }
+    int year = date.year - PACKED_DATE_BASE_YEAR;
+    if (year < 0 || year > 127 || date.month < 1 || date.month > 12 || date.day < 1 || date.day > 31) return false;
+    packed = static_cast<uint16_t>(year << 9 | date.month << 5 | date.day);
+    return true;
+}
+
+//-----------------------------------------------
+Date unpackDate(uint16_t packed)
+{
+    if (packed == 0) return Date{0, 0, 0};
+    return Date{PACKED_DATE_BASE_YEAR + (packed >> 9), (packed >> 5) & 15, packed & 31};
+}
+
+//============================================
+// Reservation: the ID is plate + sailing ID, '*'-padded to 20 characters
+// when makeReservationID built it, so only that choice is stored
+
+bool ReservationCodec::encode(const Reservation &in, ReservationRecord &out)
+{
+    uint32_t sailing;
+    uint16_t returnDate;
+    uint64_t plate;
+    if (!encodeSailingID(in.sailingID, sailing) || !packDate(in.expectedReturnDate, returnDate)) return false;
+    if (!encodePlate(in.licensePlate, plate)) return false;  // Needed for its ReservationKey
+    if (!packText(in.licensePlate, out.licensePlate) || !packText(in.phone, out.phone)) return false;
+
+    char plainID[sizeof(in.id)];
+    snprintf(plainID, sizeof(plainID), "%.*s%s", static_cast<int>(sizeof(out.licensePlate)), out.licensePlate,
+             in.sailingID);
+    size_t plainLength = strlen(plainID);
+    bool padded = strncmp(in.id, plainID, sizeof(in.id)) != 0;
+    if (padded)
+    {
+        // Only makeReservationID's padded form can be rebuilt
+        if (strnlen(in.id, sizeof(in.id)) != sizeof(in.id) - 1 || strncmp(in.id, plainID, plainLength) != 0) return false;
+        for (size_t i = plainLength; i < sizeof(in.id) - 1; ++i)
+        {
+            if (in.id[i] != '*') return false;
+        }
+    }
+
+    storeLittleEndian<uint32_t>(out.sailing, sailing);
+    storeInt32(out.vehicleLength, in.vehicleLength);
+    storeInt32(out.vehicleHeight, in.vehicleHeight);
+    out.flags = static_cast<unsigned char>((in.onboard ? RESERVATION_ONBOARD : 0) |
+                                           (in.reservedLane == Lane::HIGH ? RESERVATION_HIGH_LANE : 0) |
+                                           (padded ? RESERVATION_PADDED_ID : 0));
+    storeLittleEndian<uint16_t>(out.returnDate, returnDate);
+    return true;
+}
+
+Reservation ReservationCodec::decode(const ReservationRecord &in)
+{
+    Reservation out{};
+    if (!isLive(in)) return out;
+
+    unpackText(in.licensePlate, out.licensePlate);
+    decodeSailingID(loadLittleEndian<uint32_t>(in.sailing), out.sailingID);
+    snprintf(out.id, sizeof(out.id), "%s%s", out.licensePlate, out.sailingID);
+    if (in.flags & RESERVATION_PADDED_ID)
+    {
+        for (size_t i = strlen(out.id); i < sizeof(out.id) - 1; ++i) out.id[i] = '*';
+    }
+    out.vehicleLength = loadInt32(in.vehicleLength);
+    out.vehicleHeight = loadInt32(in.vehicleHeight);
+    unpackText(in.phone, out.phone);
+    out.onboard = (in.flags & RESERVATION_ONBOARD) != 0;
+    out.expectedReturnDate = unpackDate(loadLittleEndian<uint16_t>(in.returnDate));
+    out.reservedLane = (in.flags & RESERVATION_HIGH_LANE) ? Lane::HIGH : Lane::LOW;
+    return out;
+}
+
+bool ReservationCodec::isLive(const ReservationRecord &in)
+{
+    return loadLittleEndian<uint32_t>(in.sailing) != 0;
+}
+
+//============================================
+bool SailingCodec::encode(const Sailing &in, SailingRecord &out)
+{
+    uint32_t sailing;
+    if (!encodeSailingID(in.id, sailing) || !packText(in.vesselName, out.vesselName)) return false;
+    storeLittleEndian<uint32_t>(out.sailing, sailing);
+    storeInt32(out.LRL, in.LRL);
+    storeInt32(out.HRL, in.HRL);
+    storeInt32(out.reservationsCount, in.reservationsCount);
+    return true;
+}
+
+Sailing SailingCodec::decode(const SailingRecord &in)
+{
+    Sailing out{};
+    if (!isLive(in)) return out;
+
+    decodeSailingID(loadLittleEndian<uint32_t>(in.sailing), out.id);
+    unpackText(in.vesselName, out.vesselName);
+    out.LRL = loadInt32(in.LRL);
+    out.HRL = loadInt32(in.HRL);
+    out.reservationsCount = loadInt32(in.reservationsCount);
+    return out;
+}
+
+bool SailingCodec::isLive(const SailingRecord &in)
+{
+    return loadLittleEndian<uint32_t>(in.sailing) != 0;
+}
+
+//============================================
+bool VesselCodec::encode(const Vessel &in, VesselRecord &out)
+{
+    if (!packText(in.name, out.name)) return false;
+    storeInt32(out.lowCap, in.lowCap);
+    storeInt32(out.highCap, in.highCap);
+    return true;
+}
+
+Vessel VesselCodec::decode(const VesselRecord &in)
+{
+    Vessel out{};
+    unpackText(in.name, out.name);
+    out.lowCap = loadInt32(in.lowCap);
+    out.highCap = loadInt32(in.highCap);
+    return out;
+}
+
+//============================================
+bool VehicleCodec::encode(const Vehicle &in, VehicleRecord &out)
+{
+    if (!packText(in.licensePlate, out.licensePlate) || !packText(in.phone, out.phone)) return false;
+    storeInt32(out.vehicleLength, in.vehicleLength);
+    storeInt32(out.vehicleHeight, in.vehicleHeight);
+    return true;
+}
+
+Vehicle VehicleCodec::decode(const VehicleRecord &in)
+{
+    Vehicle out{};
+    unpackText(in.licensePlate, out.licensePlate);
+    unpackText(in.phone, out.phone);
+    out.vehicleLength = loadInt32(in.vehicleLength);
+    out.vehicleHeight = loadInt32(in.vehicleHeight);
+    return out;
+}
@@ -0,0 +1,159 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: RecordFormat.h
+/*
+    Module: RecordFormat.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Packed on-disk records (format v2) for the four data files and the
+        codecs RecordStore uses to move between them and the in-memory
+        structs. Records have no padding and store multi-byte fields
+        little-endian. Sailing IDs are stored as their 32-bit code, dates
+        in 16 bits and the lane with the onboard flag in one byte, and the
+        reservation ID (plate + sailing ID) is rebuilt instead of stored:
+        a reservation shrinks from 84 to 39 bytes.
+*/
+
+#ifndef RECORD_FORMAT_H
+#define RECORD_FORMAT_H
+
+#include <cstdint>
+#include "Date.h"
+#include "Reservation.h"
+#include "Sailing.h"
+#include "Vehicle.h"
+#include "Vessel.h"
+
+//-----------------------------------------------
+// Struct:  ReservationRecord
+// Purpose: Packed reservation. A zeroed record (sailing code 0) is a tombstone.
+struct ReservationRecord
+{
+    char licensePlate[10];            // zero-padded; no terminator when full
+    unsigned char sailing[4];         // encodeSailingID code
+    unsigned char vehicleLength[4];   // centimetres
+    unsigned char vehicleHeight[4];   // centimetres
+    char phone[14];                   // zero-padded
+    unsigned char flags;              // RESERVATION_* bits below
+    unsigned char returnDate[2];      // packDate form, 0 = none
+};
+
+static constexpr unsigned char RESERVATION_ONBOARD = 0x01;
+static constexpr unsigned char RESERVATION_HIGH_LANE = 0x02;
+static constexpr unsigned char RESERVATION_PADDED_ID = 0x04;  // ID is '*'-padded to 20 characters
+
+//-----------------------------------------------
+// Struct:  SailingRecord
+// Purpose: Packed sailing. A zeroed record (sailing code 0) is a tombstone.
+struct SailingRecord
+{
+    unsigned char sailing[4];            // encodeSailingID code
+    char vesselName[25];                 // zero-padded
+    unsigned char LRL[4];                // centimetres
+    unsigned char HRL[4];                // centimetres
+    unsigned char reservationsCount[4];
+};
+
+//-----------------------------------------------
+// Struct:  VesselRecord
+struct VesselRecord
+{
+    char name[25];                // zero-padded; empty = tombstone
+    unsigned char lowCap[4];      // centimetres
+    unsigned char highCap[4];     // centimetres
+};
+
+//-----------------------------------------------
+// Struct:  VehicleRecord
+struct VehicleRecord
+{
+    char licensePlate[10];            // zero-padded; empty = tombstone
+    char phone[12];                   // zero-padded
+    unsigned char vehicleLength[4];   // centimetres
+    unsigned char vehicleHeight[4];   // centimetres
+};
+
+static_assert(sizeof(ReservationRecord) == 39 && sizeof(SailingRecord) == 41 &&
+              sizeof(VesselRecord) == 33 && sizeof(VehicleRecord) == 30,
+              "packed records must not be padded");
+
+//-----------------------------------------------
+bool encodeSailingID(
+    const char *id,        // in: sailing ID
+    std::uint32_t &code    // out: encoded ID
+);
+// out: false if the ID is not a well-formed XXX-DD-HH (letters, day 01-31, hour 00-23)
+// Purpose: Encode a sailing ID as (terminal letters, 6 bits each) << 10 | (day-1)*24 + hour.
+// The code is stable across runs, unique per ID and never 0.
+
+//-----------------------------------------------
+void decodeSailingID(
+    std::uint32_t code,  // in: code from encodeSailingID, or 0
+    char id[10]          // out: sailing ID ("" for 0)
+);
+
+//-----------------------------------------------
+bool encodePlate(
+    const char *plate,     // in: license plate
+    std::uint64_t &code    // out: encoded plate
+);
+// out: false unless the plate is 1-10 of the characters '-', 0-9, A-Z, a-z
+// Purpose: Pack a plate 6 bits per character, first character in the top
+// bits and 0 after the end, so codes order as the plates do under strcmp.
+
+//-----------------------------------------------
+void decodePlate(
+    std::uint64_t code,  // in: code from encodePlate
+    char plate[11]       // out: license plate
+);
+
+//-----------------------------------------------
+bool packDate(
+    const Date &date,     // in: date, or {0, 0, 0} for none
+    std::uint16_t &packed // out: (year - 2000) << 9 | month << 5 | day, or 0
+);
+// out: false if the date is outside 2000-2127 or not a month/day pair
+
+//-----------------------------------------------
+Date unpackDate(
+    std::uint16_t packed  // in: packDate form
+);
+
+//-----------------------------------------------
+// Codecs: Record is the on-disk type; encode() fails on a value the
+// packed form cannot hold (a reservation's plate must also encodePlate,
+// so every stored reservation has a ReservationKey); decode() of a
+// tombstone gives a zeroed struct.
+struct ReservationCodec
+{
+    using Record = ReservationRecord;
+    static bool encode(const Reservation &in, ReservationRecord &out);
+    static Reservation decode(const ReservationRecord &in);
+    static bool isLive(const ReservationRecord &in);
+};
+
+struct SailingCodec
+{
+    using Record = SailingRecord;
+    static bool encode(const Sailing &in, SailingRecord &out);
+    static Sailing decode(const SailingRecord &in);
+    static bool isLive(const SailingRecord &in);
+};
+
+struct VesselCodec
+{
+    using Record = VesselRecord;
+    static bool encode(const Vessel &in, VesselRecord &out);
+    static Vessel decode(const VesselRecord &in);
+    static bool isLive(const VesselRecord &in) { return in.name[0] != '\0'; }
+};
+
+struct VehicleCodec
+{
+    using Record = VehicleRecord;
+    static bool encode(const Vehicle &in, VehicleRecord &out);
+    static Vehicle decode(const VehicleRecord &in);
+    static bool isLive(const VehicleRecord &in) { return in.licensePlate[0] != '\0'; }
+};
+
+#endif // RECORD_FORMAT_H
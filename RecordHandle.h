@@ -0,0 +1,35 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: RecordHandle.h
+/*
+    Module: RecordHandle.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Defines the handle the storage modules hand out for a record they
+        have looked up, so follow-up reads, updates and deletes go straight
+        to the record's slot instead of searching for its key again.
+*/
+
+#ifndef RECORD_HANDLE_H
+#define RECORD_HANDLE_H
+
+#include <cstdint>
+
+//-----------------------------------------------
+// Struct:  RecordHandle
+// in:      slot       – position of the record in its .dat file
+//          generation – the slot's generation when the handle was issued
+//          partition  – which file of a partitioned data set holds the
+//                       record (the sailing code for reservations), else 0
+// Purpose: Stable reference to one stored record. The store gives a slot a
+//          new generation whenever its record is deleted or moved (e.g. by
+//          compaction), so a handle to a record that is gone no longer
+//          resolves rather than reaching whatever record took its place.
+struct RecordHandle
+{
+    std::uint32_t slot = 0;
+    std::uint32_t generation = 0;  // 0 is never issued: a default handle resolves to nothing
+    std::uint32_t partition = 0;
+};
+
+#endif // RECORD_HANDLE_H
@@ -0,0 +1,783 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: RecordStore.h
+/*
+    Module: RecordStore.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Generic fixed-length record file shared by all ASM modules. The .dat
+        file (format v2) is a 64-byte header - magic, version, record size,
+        record count, checksum and a clean-close flag - followed by a plain
+        array of packed records. A codec converts between the packed record
+        and the in-memory struct, so records are decoded on read and
+        encoded on write. The file is memory-mapped, grown in chunks while
+        open and trimmed back to its logical size on close; the checksum is
+        written on close and verified on the next open after a clean close.
+        Deletes leave a tombstone (a zeroed record) whose slot goes on a
+        free-slot list saved beside the data file (<file>.free); compact()
+        removes tombstones while keeping the remaining records in order.
+        Full-file passes go through the block scan engine (scanBlocks and the
+        helpers built on it): the mapping is walked in ~64 KiB blocks of
+        whole records, with the kernel told the access is sequential and the
+        next block prefetched while the caller's callback runs on the current
+        one in place.
+        Every slot carries a generation, renewed whenever the slot's record is
+        deleted, reused for another record or moved, so a RecordHandle
+        (slot + generation) detects that the record it named is gone.
+        Generations come from one counter per record type, so they stay
+        unique across the stores of a partitioned data set even when a
+        partition is dropped and created again.
+*/
+
+#ifndef RECORD_STORE_H
+#define RECORD_STORE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "LittleEndian.h"
+#include "RecordHandle.h"
+
+//-----------------------------------------------
+// Constants
+static constexpr std::size_t RECORD_STORE_CHUNK_BYTES = 64 * 1024;  // file growth granularity
+static constexpr std::size_t RECORD_STORE_SCAN_BLOCK_BYTES = 64 * 1024;  // scan engine block size
+static constexpr std::uint32_t RECORD_STORE_FREE_MAGIC = 0x31455246; // "FRE1"
+static constexpr double RECORD_STORE_COMPACT_RATIO = 0.25;          // compact once a quarter of the slots are tombstones
+static constexpr std::size_t RECORD_STORE_COMPACT_MIN_GARBAGE = 64; // ...and at least this many
+static constexpr std::uint32_t RECORD_FILE_MAGIC = 0x44524646;      // "FFRD"
+static constexpr std::uint32_t RECORD_FILE_VERSION = 2;             // v1 was the headerless struct dump
+static constexpr std::size_t RECORD_FILE_HEADER_BYTES = 64;
+static constexpr std::uint64_t RECORD_FILE_CHECKSUM_SEED = 0x9E3779B97F4A7C15ull;
+
+//-----------------------------------------------
+// Struct:  RecordFileHeader
+// Purpose: Header of a v2 record file, stored little-endian in the first
+//          RECORD_FILE_HEADER_BYTES bytes (the rest is zero).
+struct RecordFileHeader
+{
+    std::uint32_t magic = RECORD_FILE_MAGIC;
+    std::uint32_t version = RECORD_FILE_VERSION;
+    std::uint32_t recordSize = 0;
+    std::uint32_t clean = 0;      // 1 after a clean close; count and checksum are then exact
+    std::uint64_t count = 0;      // records following the header
+    std::uint64_t checksum = 0;   // recordFileChecksum over those records
+};
+
+//-----------------------------------------------
+inline void storeRecordFileHeader(
+    const RecordFileHeader &header,  // in: header fields
+    unsigned char *bytes             // out: RECORD_FILE_HEADER_BYTES bytes
+)
+{
+    std::memset(bytes, 0, RECORD_FILE_HEADER_BYTES);
+    storeLittleEndian(bytes, header.magic);
+    storeLittleEndian(bytes + 4, header.version);
+    storeLittleEndian(bytes + 8, header.recordSize);
+    storeLittleEndian(bytes + 12, header.clean);
+    storeLittleEndian(bytes + 16, header.count);
+    storeLittleEndian(bytes + 24, header.checksum);
+}
+
+//-----------------------------------------------
+inline RecordFileHeader loadRecordFileHeader(
+    const unsigned char *bytes  // in: RECORD_FILE_HEADER_BYTES bytes
+)
+{
+    RecordFileHeader header;
+    header.magic = loadLittleEndian<std::uint32_t>(bytes);
+    header.version = loadLittleEndian<std::uint32_t>(bytes + 4);
+    header.recordSize = loadLittleEndian<std::uint32_t>(bytes + 8);
+    header.clean = loadLittleEndian<std::uint32_t>(bytes + 12);
+    header.count = loadLittleEndian<std::uint64_t>(bytes + 16);
+    header.checksum = loadLittleEndian<std::uint64_t>(bytes + 24);
+    return header;
+}
+
+//-----------------------------------------------
+inline std::uint64_t recordFileChecksum(
+    std::uint64_t h,                 // in: RECORD_FILE_CHECKSUM_SEED, or the checksum of the records before these
+    const void *records,             // in: packed records
+    std::size_t recordSize,          // in: bytes per record
+    std::size_t n                    // in: number of records
+)
+// Record-at-a-time, so a file checksummed in any number of runs of whole
+// records gives the same value. Word-at-a-time multiply/xor-shift.
+{
+    const unsigned char *bytes = static_cast<const unsigned char*>(records);
+    for (std::size_t i = 0; i < n; ++i, bytes += recordSize)
+    {
+        std::size_t j = 0;
+        for (; j + 8 <= recordSize; j += 8)
+        {
+            h = (h ^ loadLittleEndian<std::uint64_t>(bytes + j)) * 0xFF51AFD7ED558CCDull;
+            h ^= h >> 32;
+        }
+        std::uint64_t tail = static_cast<std::uint64_t>(recordSize) << 56;
+        for (std::size_t k = j; k < recordSize; ++k)
+        {
+            tail ^= static_cast<std::uint64_t>(bytes[k]) << (8 * (k - j));
+        }
+        h = (h ^ tail) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
+//-----------------------------------------------
+// Class:   RecordStore
+// in:      T     – in-memory record struct
+//          Codec – provides `using Record` (the packed on-disk record),
+//                  `static bool encode(const T&, Record&)`,
+//                  `static T decode(const Record&)` and
+//                  `static bool isLive(const Record&)`
+// Purpose: Owns one memory-mapped .dat file of packed records.
+//          A zeroed record is not live and marks unused space: either a
+//          tombstone left by erase() or growth space left by a crash.
+//          Trailing unused records are trimmed on open; other tombstones
+//          stay until compact() or, with slot reuse on, the next append.
+template <typename T, typename Codec>
+class RecordStore
+{
+public:
+    using Record = typename Codec::Record;
+
+private:
+    static_assert(std::is_trivially_copyable<Record>::value, "RecordStore records must be trivially copyable");
+
+public:
+    RecordStore() = default;
+    RecordStore(const RecordStore &) = delete;
+    RecordStore &operator=(const RecordStore &) = delete;
+    ~RecordStore() { close(); }
+
+    //-----------------------------------------------
+    bool open(
+        const std::string &path,       // in: data file, created if missing
+        bool reuseFreeSlots = false    // in: let append() fill tombstoned slots
+    )
+    {
+        if (isOpen()) return true;
+        filePath = path;
+        reuseFree = reuseFreeSlots;
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0)
+        {
+            std::cerr << "Error: Failed to open " << path << "." << std::endl;
+            return false;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            abortOpen();
+            return false;
+        }
+        RecordFileHeader header;
+        header.recordSize = sizeof(Record);
+        std::size_t fileSize = static_cast<std::size_t>(st.st_size);
+        if (fileSize > 0)
+        {
+            unsigned char bytes[RECORD_FILE_HEADER_BYTES];
+            if (fileSize >= RECORD_FILE_HEADER_BYTES && pread(fd, bytes, sizeof(bytes), 0) == sizeof(bytes))
+            {
+                header = loadRecordFileHeader(bytes);
+            }
+            if (fileSize < RECORD_FILE_HEADER_BYTES || header.magic != RECORD_FILE_MAGIC ||
+                header.version != RECORD_FILE_VERSION || header.recordSize != sizeof(Record))
+            {
+                std::cerr << "Error: " << path << " is not a v" << RECORD_FILE_VERSION
+                          << " record file; run ./migrate to convert it." << std::endl;
+                abortOpen();
+                return false;
+            }
+        }
+        count = fileSize < RECORD_FILE_HEADER_BYTES ? 0 : (fileSize - RECORD_FILE_HEADER_BYTES) / sizeof(Record);
+        if (header.clean)
+        {
+            if (header.count > count)
+            {
+                std::cerr << "Error: " << path << " is shorter than its header says." << std::endl;
+                abortOpen();
+                return false;
+            }
+            count = static_cast<std::size_t>(header.count);  // Anything after it was never written
+
+            // Checked before the file is grown for mapping, so a rejected file is left as it was
+            if (!checksumMatches(header, fileSize))
+            {
+                std::cerr << "Error: " << path << " failed its checksum." << std::endl;
+                abortOpen();
+                return false;
+            }
+        }
+        if (!mapCapacity(std::max<std::size_t>(count, 1)))
+        {
+            abortOpen();
+            return false;
+        }
+
+        // Drop zero-filled growth space left behind by an unclean shutdown
+        while (count > 0 && !isLive(count - 1))
+        {
+            --count;
+        }
+        loadFreeSlots();
+        generations.assign(count, nextGeneration++);
+
+        // Until the next clean close the header's count and checksum are stale
+        header.clean = 0;
+        if (!writeHeader(header))
+        {
+            std::cerr << "Error: Failed to write the header of " << path << "." << std::endl;
+            abortOpen();
+            return false;
+        }
+        return true;
+    }
+    // Maps the file for read/write. Returns false if it cannot be opened;
+    // a file that is rejected (wrong format, short, bad checksum) is left
+    // untouched for ./migrate or inspection.
+
+    //-----------------------------------------------
+    void close()
+    {
+        if (isOpen())
+        {
+            saveFreeSlots();
+            msync(mapping, mappedBytes(), MS_SYNC);  // Records reach the file before the clean header
+
+            RecordFileHeader header;
+            header.recordSize = sizeof(Record);
+            header.clean = 1;
+            header.count = count;
+            header.checksum = recordFileChecksum(RECORD_FILE_CHECKSUM_SEED, base, sizeof(Record), count);
+            if (!writeHeader(header))
+            {
+                std::cerr << "Error: Failed to write the header of " << filePath << "." << std::endl;
+            }
+        }
+        if (mapping != nullptr)
+        {
+            munmap(mapping, mappedBytes());
+            mapping = nullptr;
+            base = nullptr;
+        }
+        if (fd >= 0)
+        {
+            // Give back the unused growth chunk so the file is exactly count records
+            if (ftruncate(fd, static_cast<off_t>(RECORD_FILE_HEADER_BYTES + count * sizeof(Record))) != 0)
+            {
+                std::cerr << "Error: Failed to trim " << filePath << "." << std::endl;
+            }
+            ::close(fd);
+            fd = -1;
+        }
+        capacity = 0;
+        count = 0;
+        freeSlots.clear();
+        generations.clear();
+    }
+    // Flushes the mapping, writes a clean header with the record count and
+    // checksum, trims the file to its logical size, saves the free-slot
+    // list and closes the file.
+
+    //-----------------------------------------------
+    void drop()
+    {
+        if (mapping != nullptr)
+        {
+            munmap(mapping, mappedBytes());
+            mapping = nullptr;
+            base = nullptr;
+        }
+        if (fd >= 0)
+        {
+            ::close(fd);
+            fd = -1;
+        }
+        if (!filePath.empty())
+        {
+            ::unlink(filePath.c_str());
+            ::unlink((filePath + ".free").c_str());
+        }
+        capacity = 0;
+        count = 0;
+        freeSlots.clear();
+        generations.clear();
+    }
+    // Closes the store without writing anything back and deletes its data
+    // file and free-slot list (a dropped partition).
+
+    //-----------------------------------------------
+    bool isOpen() const { return fd >= 0 && base != nullptr; }
+
+    //-----------------------------------------------
+    std::size_t size() const { return count; }
+    // Number of slots in the file, tombstones included.
+
+    //-----------------------------------------------
+    std::size_t liveCount() const { return count - freeSlots.size(); }
+    // Number of records that have not been erased.
+
+    //-----------------------------------------------
+    double garbageRatio() const { return count == 0 ? 0.0 : static_cast<double>(freeSlots.size()) / count; }
+    // Fraction of slots holding tombstones.
+
+    //-----------------------------------------------
+    bool needsCompaction() const
+    {
+        return freeSlots.size() >= RECORD_STORE_COMPACT_MIN_GARBAGE && garbageRatio() >= RECORD_STORE_COMPACT_RATIO;
+    }
+    // True once tombstones pass the garbage threshold.
+
+    //-----------------------------------------------
+    bool isLive(std::size_t slot) const { return Codec::isLive(base[slot]); }
+    // True unless the slot holds a tombstone; slot must be < size().
+
+    //-----------------------------------------------
+    RecordHandle handle(std::size_t slot) const
+    {
+        return RecordHandle{static_cast<std::uint32_t>(slot), generations[slot]};
+    }
+    // Handle to the record now in slot; slot must be < size().
+
+    //-----------------------------------------------
+    bool isCurrent(const RecordHandle &h) const
+    {
+        return isOpen() && h.slot < count && generations[h.slot] == h.generation && isLive(h.slot);
+    }
+    // True if the record the handle was issued for is still in its slot.
+
+    //-----------------------------------------------
+    std::size_t byteSize() const { return RECORD_FILE_HEADER_BYTES + count * sizeof(Record); }
+    // Logical size of the data file in bytes, header included.
+
+    //-----------------------------------------------
+    template <typename BlockVisitor>
+    bool scanBlocks(
+        BlockVisitor visit  // in: bool(const Record *block, std::size_t firstSlot, std::size_t n); false stops the scan
+    ) const
+    {
+        if (base == nullptr || count == 0) return true;
+        const std::size_t perBlock = std::max<std::size_t>(1, RECORD_STORE_SCAN_BLOCK_BYTES / sizeof(Record));
+
+        adviseSequential(true);
+        bool completed = true;
+        // Loop goal: hand each block of whole records to visit, in slot order
+        for (std::size_t first = 0; first < count; first += perBlock)
+        {
+            std::size_t n = std::min(perBlock, count - first);
+            if (first + n < count) prefetch(first + n, std::min(perBlock, count - first - n));
+            if (!visit(static_cast<const Record*>(base + first), first, n))
+            {
+                completed = false;
+                break;
+            }
+        }
+        adviseSequential(false);
+        return completed;
+    }
+    // Block scan engine: runs visit over the mapping one ~64 KiB block of
+    // packed records at a time, tombstones included. Returns false if visit
+    // stopped it.
+
+    //-----------------------------------------------
+    template <typename RecordVisitor>
+    void forEachLive(
+        RecordVisitor visit  // in: void(std::size_t slot, const T &record)
+    ) const
+    {
+        scanBlocks([&](const Record *block, std::size_t firstSlot, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (Codec::isLive(block[i])) visit(firstSlot + i, Codec::decode(block[i]));
+            }
+            return true;
+        });
+    }
+    // Calls visit with every non-tombstone record, decoded, in slot order.
+
+    //-----------------------------------------------
+    template <typename Predicate>
+    long findIf(
+        Predicate matches  // in: bool(const T &record)
+    ) const
+    {
+        long found = -1;
+        scanBlocks([&](const Record *block, std::size_t firstSlot, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (Codec::isLive(block[i]) && matches(Codec::decode(block[i])))
+                {
+                    found = static_cast<long>(firstSlot + i);
+                    return false;
+                }
+            }
+            return true;
+        });
+        return found;
+    }
+    // First live slot whose record satisfies the predicate, or -1.
+
+    //-----------------------------------------------
+    T at(std::size_t slot) const { return Codec::decode(base[slot]); }
+    // Decoded copy of a record; slot must be < size().
+
+    //-----------------------------------------------
+    const Record &packed(std::size_t slot) const { return base[slot]; }
+    // The record as stored, in place; slot must be < size().
+
+    //-----------------------------------------------
+    bool append(
+        const T &record,              // in: record to add
+        std::size_t *slot = nullptr   // out: slot the record was written to
+    )
+    {
+        if (!isOpen()) return false;
+        Record packedRecord;
+        if (!encode(record, packedRecord)) return false;
+        if (reuseFree && !freeSlots.empty())  // Fill a tombstone before growing
+        {
+            std::size_t reused = freeSlots.back();
+            freeSlots.pop_back();
+            base[reused] = packedRecord;
+            generations[reused] = nextGeneration++;
+            if (slot != nullptr) *slot = reused;
+            return true;
+        }
+        if (count == capacity && !mapCapacity(growTo(count + 1))) return false;
+        base[count] = packedRecord;
+        if (slot != nullptr) *slot = count;
+        generations.push_back(nextGeneration++);
+        ++count;
+        return true;
+    }
+    // Adds a record in a free slot when slot reuse is on, otherwise after the
+    // last one, growing the file by a chunk if needed. Returns false if the
+    // record cannot be encoded.
+
+    //-----------------------------------------------
+    bool write(
+        std::size_t slot,  // in: slot to overwrite
+        const T &record    // in: new record contents
+    )
+    {
+        if (!isOpen() || slot >= count) return false;
+        Record packedRecord;
+        if (!encode(record, packedRecord)) return false;
+        base[slot] = packedRecord;
+        return true;
+    }
+    // Overwrites an existing record in place.
+
+    //-----------------------------------------------
+    bool erase(
+        std::size_t slot  // in: slot to remove
+    )
+    {
+        if (!isOpen() || slot >= count || !isLive(slot)) return false;
+        std::memset(static_cast<void*>(base + slot), 0, sizeof(Record));  // Tombstone: zeroed record
+        freeSlots.push_back(static_cast<std::uint32_t>(slot));
+        generations[slot] = nextGeneration++;  // Outstanding handles to the record stop resolving
+        return true;
+    }
+    // Tombstones a record in O(1). No other record moves.
+
+    //-----------------------------------------------
+    bool compact()
+    {
+        if (!isOpen()) return false;
+        if (freeSlots.empty()) return true;
+
+        // Copy live records in order to a side file, then swap it in with
+        // rename() so a crash leaves either the old or the new file intact
+        const std::string tempPath = filePath + ".compact";
+        int out = ::open(tempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (out < 0) return false;
+
+        // Header (not clean: the store stays open on the new file), then the live records as stored
+        std::vector<unsigned char> bytes(RECORD_FILE_HEADER_BYTES);
+        RecordFileHeader header;
+        header.recordSize = sizeof(Record);
+        storeRecordFileHeader(header, bytes.data());
+        std::size_t liveRecords = 0;
+        scanBlocks([&](const Record *block, std::size_t, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (!Codec::isLive(block[i])) continue;
+                const unsigned char *record = reinterpret_cast<const unsigned char*>(block + i);
+                bytes.insert(bytes.end(), record, record + sizeof(Record));
+                ++liveRecords;
+            }
+            return true;
+        });
+        const unsigned char *data = bytes.data();
+        std::size_t remaining = bytes.size();
+        while (remaining > 0)
+        {
+            ssize_t written = ::write(out, data, remaining);
+            if (written < 0)
+            {
+                ::close(out);
+                ::unlink(tempPath.c_str());
+                return false;
+            }
+            data += written;
+            remaining -= static_cast<std::size_t>(written);
+        }
+        if (fsync(out) != 0 || std::rename(tempPath.c_str(), filePath.c_str()) != 0)
+        {
+            ::close(out);
+            ::unlink(tempPath.c_str());
+            return false;
+        }
+
+        munmap(mapping, mappedBytes());
+        mapping = nullptr;
+        base = nullptr;
+        ::close(fd);
+        fd = out;
+        count = liveRecords;
+        freeSlots.clear();
+        generations.assign(count, nextGeneration++);  // Records moved: every handle is stale
+        return mapCapacity(std::max<std::size_t>(count, 1));
+    }
+    // Rewrites the file without tombstones, preserving record order.
+    // Every slot number may change, so callers rebuild their indexes.
+
+    //-----------------------------------------------
+    bool sync()
+    {
+        if (!isOpen()) return false;
+        return msync(mapping, mappedBytes(), MS_SYNC) == 0;
+    }
+    // Forces mapped changes out to disk.
+
+private:
+    // On-disk header of <file>.free, followed by freeCount slot numbers
+    struct FreeListHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t reserved;
+        std::uint64_t recordCount;  // size() when the list was saved
+        std::uint64_t freeCount;
+    };
+
+    //-----------------------------------------------
+    // helper: load the free-slot list saved by the last clean close, or
+    // rebuild it with one scan when it is missing or does not match
+    void loadFreeSlots()
+    {
+        const std::string freePath = filePath + ".free";
+        freeSlots.clear();
+        bool loaded = false;
+        if (FILE *in = std::fopen(freePath.c_str(), "rb"))
+        {
+            FreeListHeader header;
+            if (std::fread(&header, sizeof(header), 1, in) == 1 &&
+                header.magic == RECORD_STORE_FREE_MAGIC && header.recordCount == count && header.freeCount <= count)
+            {
+                freeSlots.resize(header.freeCount);
+                loaded = std::fread(freeSlots.data(), sizeof(std::uint32_t), freeSlots.size(), in) == freeSlots.size();
+                for (std::size_t i = 0; loaded && i < freeSlots.size(); ++i)
+                {
+                    loaded = freeSlots[i] < count && !isLive(freeSlots[i]);
+                }
+            }
+            std::fclose(in);
+        }
+        // The list is only trusted after a clean close, so drop it while open
+        std::remove(freePath.c_str());
+
+        if (!loaded)
+        {
+            freeSlots.clear();
+            scanBlocks([&](const Record *block, std::size_t firstSlot, std::size_t n) {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (!Codec::isLive(block[i])) freeSlots.push_back(static_cast<std::uint32_t>(firstSlot + i));
+                }
+                return true;
+            });
+        }
+    }
+
+    //-----------------------------------------------
+    // helper: save the free-slot list for the next open; none is written
+    // when there are no tombstones
+    void saveFreeSlots()
+    {
+        // Tombstones at the end are trimmed by close(), so leave them out
+        std::size_t finalCount = count;
+        while (finalCount > 0 && !isLive(finalCount - 1)) --finalCount;
+        std::vector<std::uint32_t> kept;
+        for (std::uint32_t slot : freeSlots)
+        {
+            if (slot < finalCount) kept.push_back(slot);
+        }
+        count = finalCount;
+        if (kept.empty()) return;
+
+        const std::string freePath = filePath + ".free";
+        if (FILE *out = std::fopen(freePath.c_str(), "wb"))
+        {
+            FreeListHeader header{RECORD_STORE_FREE_MAGIC, 0, count, kept.size()};
+            std::fwrite(&header, sizeof(header), 1, out);
+            std::fwrite(kept.data(), sizeof(std::uint32_t), kept.size(), out);
+            std::fclose(out);
+        }
+    }
+
+    //-----------------------------------------------
+    // helper: encode a record, reporting values the packed form cannot hold
+    bool encode(const T &record, Record &packedRecord) const
+    {
+        std::memset(static_cast<void*>(&packedRecord), 0, sizeof(Record));
+        if (Codec::encode(record, packedRecord)) return true;
+        std::cerr << "Error: A record cannot be stored in " << filePath << " (value outside the packed format)." << std::endl;
+        return false;
+    }
+
+    //-----------------------------------------------
+    // helper: write the header into the mapping and force it to disk
+    bool writeHeader(const RecordFileHeader &header)
+    {
+        storeRecordFileHeader(header, reinterpret_cast<unsigned char*>(mapping));
+        return msync(mapping, RECORD_FILE_HEADER_BYTES, MS_SYNC) == 0;
+    }
+
+    //-----------------------------------------------
+    // helper: bytes mapped for the header and capacity records
+    std::size_t mappedBytes() const { return RECORD_FILE_HEADER_BYTES + capacity * sizeof(Record); }
+
+    //-----------------------------------------------
+    // helper: page-aligned byte range covering slots [first, first + n)
+    void pageRange(std::size_t first, std::size_t n, char *&start, std::size_t &length) const
+    {
+        static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        char *begin = reinterpret_cast<char*>(base + first);
+        char *end = reinterpret_cast<char*>(base + first + n);
+        start = reinterpret_cast<char*>(reinterpret_cast<std::uintptr_t>(begin) & ~(pageSize - 1));
+        length = static_cast<std::size_t>(end - start);
+    }
+
+    //-----------------------------------------------
+    // helper: tell the kernel a full pass is starting (read ahead
+    // aggressively) or has ended (back to default paging)
+    void adviseSequential(bool on) const
+    {
+        char *start;
+        std::size_t length;
+        pageRange(0, count, start, length);
+        madvise(start, length, on ? MADV_SEQUENTIAL : MADV_NORMAL);
+    }
+
+    //-----------------------------------------------
+    // helper: start paging in the next block while the current one is visited
+    void prefetch(std::size_t first, std::size_t n) const
+    {
+        char *start;
+        std::size_t length;
+        pageRange(first, n, start, length);
+        madvise(start, length, MADV_WILLNEED);
+    }
+
+    //-----------------------------------------------
+    // helper: capacity for at least needed records, rounded up to whole
+    // chunks and grown geometrically so appends stay amortized O(1)
+    static std::size_t growTo(std::size_t needed)
+    {
+        const std::size_t perChunk = std::max<std::size_t>(1, RECORD_STORE_CHUNK_BYTES / sizeof(Record));
+        std::size_t target = std::max(needed, needed + needed / 2);
+        return ((target + perChunk - 1) / perChunk) * perChunk;
+    }
+
+    //-----------------------------------------------
+    // helper: give up a failed open without writing a header or trimming
+    // the file, so a rejected file is left exactly as it was
+    void abortOpen()
+    {
+        if (mapping != nullptr)
+        {
+            munmap(mapping, mappedBytes());
+            mapping = nullptr;
+            base = nullptr;
+        }
+        if (fd >= 0)
+        {
+            ::close(fd);
+            fd = -1;
+        }
+        capacity = 0;
+        count = 0;
+        freeSlots.clear();
+        generations.clear();
+    }
+
+    //-----------------------------------------------
+    // helper: verify a clean file's first count records against its header,
+    // through a read-only mapping of the file as it stands
+    bool checksumMatches(const RecordFileHeader &header, std::size_t fileSize) const
+    {
+        void *mapped = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped == MAP_FAILED) return false;
+        const Record *records = reinterpret_cast<const Record*>(static_cast<const char*>(mapped) + RECORD_FILE_HEADER_BYTES);
+        bool matches = recordFileChecksum(RECORD_FILE_CHECKSUM_SEED, records, sizeof(Record), count) == header.checksum;
+        munmap(mapped, fileSize);
+        return matches;
+    }
+
+    //-----------------------------------------------
+    // helper: resize the file and remap it to hold newCapacity records
+    bool mapCapacity(std::size_t minimum)
+    {
+        std::size_t newCapacity = growTo(minimum);
+        if (mapping != nullptr)
+        {
+            munmap(mapping, mappedBytes());
+            mapping = nullptr;
+            base = nullptr;
+        }
+        std::size_t newBytes = RECORD_FILE_HEADER_BYTES + newCapacity * sizeof(Record);
+        if (ftruncate(fd, static_cast<off_t>(newBytes)) != 0)
+        {
+            std::cerr << "Error: Failed to grow " << filePath << "." << std::endl;
+            return false;
+        }
+        void *mapped = mmap(nullptr, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapped == MAP_FAILED)
+        {
+            std::cerr << "Error: Failed to map " << filePath << "." << std::endl;
+            return false;
+        }
+        mapping = static_cast<char*>(mapped);
+        base = reinterpret_cast<Record*>(mapping + RECORD_FILE_HEADER_BYTES);
+        capacity = newCapacity;
+        return true;
+    }
+
+    std::string filePath;
+    int fd = -1;
+    char *mapping = nullptr;    // header followed by the records
+    Record *base = nullptr;     // first record, RECORD_FILE_HEADER_BYTES into the mapping
+    std::size_t count = 0;      // records in use
+    std::size_t capacity = 0;   // records the mapping can hold
+    std::vector<std::uint32_t> freeSlots;  // tombstoned slots, most recent last
+    std::vector<std::uint32_t> generations;  // per-slot generation, parallel to the records
+    static inline std::atomic<std::uint32_t> nextGeneration{1};  // shared by every store of this type; never reused while the program runs
+    bool reuseFree = false;
+};
+
+#endif // RECORD_STORE_H
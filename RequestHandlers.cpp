@@ -0,0 +1,242 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: RequestHandlers.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the request handlers. Each request is decoded from
+        its fixed-size struct (every text field forced to be null-
+        terminated), run through ReservationService or SailingService, and
+        its result encoded as the response payload. The business rules live
+        in the services.
+
+        Concurrency: requests from every connection run in parallel. The
+        services serialize changes per sailing, the storage modules guard
+        their own tables, and each thread has its own log transaction.
+*/
+
+//============================================
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include "RequestHandlers.h"
+#include "ReservationService.h"
+#include "SailingService.h"
+
+using namespace std;
+
+//============================================
+
+//-----------------------------------------------
+// helper: decode a fixed-size request; every char field is forced to be
+// null-terminated by the caller through terminateField()
+template <typename T>
+static bool readRequest(const char *payload, size_t length, T &request)
+{
+    if (length != sizeof(T)) return false;
+    memcpy(&request, payload, sizeof(T));
+    return true;
+}
+
+template <size_t N>
+static void terminateField(char (&field)[N])
+{
+    field[N - 1] = '\0';
+}
+
+//-----------------------------------------------
+// helper: append one fixed-size value to a response
+template <typename T>
+static void writeResponse(vector<char> &response, const T &value)
+{
+    const char *bytes = reinterpret_cast<const char*>(&value);
+    response.insert(response.end(), bytes, bytes + sizeof(T));
+}
+
+//-----------------------------------------------
+static FerryStatus handleSailingReport(const SailingReportRequest &request, vector<char> &response)
+{
+    // No page may outgrow one frame
+    uint32_t maxRows = min<uint32_t>(request.maxRows,
+                                     (FERRY_MAX_PAYLOAD - sizeof(SailingReportHeader)) / sizeof(SailingRow));
+    uint32_t total = 0;
+    vector<SailingRow> rows;
+    FerryStatus status = SailingService::getReport(request.offset, maxRows, total, rows);
+    if (status != FerryStatus::OK) return status;
+
+    writeResponse(response, SailingReportHeader{total, static_cast<uint32_t>(rows.size())});
+    for (const SailingRow &row : rows) writeResponse(response, row);
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+static FerryStatus handleReservationCheckInBatch(const char *payload, size_t length, vector<char> &response)
+{
+    const size_t PLATE_SIZE = sizeof(Reservation::licensePlate);
+
+    BatchCheckInHeader header;
+    if (length < sizeof(header)) return FerryStatus::BAD_REQUEST;
+    memcpy(&header, payload, sizeof(header));
+    terminateField(header.sailingID);
+    if (header.count > FERRY_MAX_BATCH_PLATES ||  // The results would not fit in a response frame
+        length != sizeof(header) + static_cast<size_t>(header.count) * PLATE_SIZE)
+    {
+        return FerryStatus::BAD_REQUEST;
+    }
+
+    vector<array<char, sizeof(Reservation::licensePlate)>> plates(header.count);
+    vector<const char*> platePointers(header.count);
+    for (uint32_t i = 0; i < header.count; ++i)
+    {
+        memcpy(plates[i].data(), payload + sizeof(header) + i * PLATE_SIZE, PLATE_SIZE);
+        plates[i][PLATE_SIZE - 1] = '\0';
+        platePointers[i] = plates[i].data();
+    }
+
+    vector<BatchCheckInResult> results;
+    FerryStatus status = ReservationService::checkInBatch(header.sailingID, platePointers.data(),
+                                                          platePointers.size(), results);
+    if (status != FerryStatus::OK) return status;
+
+    for (const BatchCheckInResult &result : results) writeResponse(response, result);
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+// helper: decode and run one request
+static FerryStatus dispatchRequest(FerryOp op, const char *payload, size_t length, vector<char> &response)
+{
+    switch (op)
+    {
+        case FerryOp::VESSEL_CREATE:
+        {
+            Vessel request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.name);
+            return SailingService::createVessel(request);
+        }
+        case FerryOp::VESSEL_GET:
+        {
+            KeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.key);
+            Vessel vessel;
+            FerryStatus status = SailingService::getVessel(request.key, vessel);
+            if (status == FerryStatus::OK) writeResponse(response, vessel);
+            return status;
+        }
+        case FerryOp::VEHICLE_GET:
+        {
+            KeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.key);
+            Vehicle vehicle;
+            FerryStatus status = ReservationService::getVehicle(request.key, vehicle);
+            if (status == FerryStatus::OK) writeResponse(response, vehicle);
+            return status;
+        }
+        case FerryOp::SAILING_CREATE:
+        {
+            SailingCreateRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.vesselName);
+            terminateField(request.sailingID);
+            return SailingService::createSailing(request);
+        }
+        case FerryOp::SAILING_DELETE:
+        {
+            KeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.key);
+            return SailingService::deleteSailing(request.key);
+        }
+        case FerryOp::SAILING_GET:
+        {
+            KeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.key);
+            SailingRow row;
+            FerryStatus status = SailingService::getSailing(request.key, row);
+            if (status == FerryStatus::OK) writeResponse(response, row);
+            return status;
+        }
+        case FerryOp::SAILING_REPORT:
+        {
+            SailingReportRequest request;
+            if (!readRequest(payload, length, request)) break;
+            return handleSailingReport(request, response);
+        }
+        case FerryOp::RESERVATION_GET:
+        {
+            KeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.key);
+            Reservation reservation;
+            FerryStatus status = ReservationService::getReservation(request.key, reservation);
+            if (status == FerryStatus::OK) writeResponse(response, reservation);
+            return status;
+        }
+        case FerryOp::RESERVATION_CREATE:
+        {
+            ReservationCreateRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.licensePlate);
+            terminateField(request.sailingID);
+            terminateField(request.phone);
+            ReservationCreateResponse result;
+            FerryStatus status = ReservationService::create(request, result);
+            if (status == FerryStatus::OK) writeResponse(response, result);
+            return status;
+        }
+        case FerryOp::RESERVATION_CANCEL:
+        {
+            ReservationKeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.licensePlate);
+            terminateField(request.sailingID);
+            return ReservationService::cancel(request);
+        }
+        case FerryOp::RESERVATION_CHECK_IN:
+        {
+            ReservationKeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.licensePlate);
+            terminateField(request.sailingID);
+            CheckInResponse result;
+            FerryStatus status = ReservationService::checkIn(request, result);
+            if (status == FerryStatus::OK) writeResponse(response, result);
+            return status;
+        }
+        case FerryOp::RESERVATION_CHECK_IN_BATCH:
+            return handleReservationCheckInBatch(payload, length, response);
+        case FerryOp::SAILING_PREPARE:
+        {
+            KeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.key);
+            PrepareSailingResponse result;
+            FerryStatus status = ReservationService::prepareSailing(request.key, result);
+            if (status == FerryStatus::OK) writeResponse(response, result);
+            return status;
+        }
+        case FerryOp::SAILING_DEPART:
+        {
+            KeyRequest request;
+            if (!readRequest(payload, length, request)) break;
+            terminateField(request.key);
+            return ReservationService::departSailing(request.key);
+        }
+    }
+    return FerryStatus::BAD_REQUEST;  // Unknown operation or wrong payload size
+}
+
+//-----------------------------------------------
+FerryStatus handleFerryRequest(FerryOp op, const char *payload, size_t length, vector<char> &response)
+{
+    response.clear();
+
+    FerryStatus status = dispatchRequest(op, payload, length, response);
+    if (status != FerryStatus::OK) response.clear();  // Failures carry no payload
+    return status;
+}
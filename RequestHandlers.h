@@ -0,0 +1,32 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: RequestHandlers.h
+/*
+    Module: RequestHandlers.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the request handlers: the frame-level entry point that
+        decodes a request, runs it through ReservationService or
+        SailingService and encodes the result. The server calls it for each
+        frame it receives; a menu session without a server calls it directly.
+*/
+
+#ifndef REQUEST_HANDLERS_H
+#define REQUEST_HANDLERS_H
+
+#include <cstddef>
+#include <vector>
+#include "FerryProtocol.h"
+
+//-----------------------------------------------
+FerryStatus handleFerryRequest(
+    FerryOp op,                   // in: requested operation
+    const char *payload,          // in: request payload
+    std::size_t length,           // in: payload size in bytes
+    std::vector<char> &response   // out: response payload (empty unless the op returns data)
+);
+// Validates the payload and runs one operation to completion. Safe to call
+// from several threads; requests for different sailings run in parallel.
+// Storage must have been started (startup()).
+
+#endif // REQUEST_HANDLERS_H
@@ -12,6 +12,7 @@
 #ifndef RESERVATION_H
 #define RESERVATION_H
 
+#include <cstdint>
 #include <string>
 #include "Date.h"
 
@@ -25,8 +26,8 @@ struct Reservation { //vehicle data + reservation
     char id[21];             // reservation ID (licensePlate + sailingID + null)    
     char licensePlate[11];   // vehicle plate (max 10 + null)
     char sailingID[10];      // nsailing ID (e.g., XXX-DD-HH + null)
-    float vehicleLength;     // 4 bytes (in meters)
-    float vehicleHeight;     // 4 bytes (in meters)
+    std::int32_t vehicleLength;  // 4 bytes (in centimetres)
+    std::int32_t vehicleHeight;  // 4 bytes (in centimetres)
     char phone[15];          // contact phone (eg, 1-604-333-2222 + null)
     bool onboard;            // 1 byte
     Date expectedReturnDate;
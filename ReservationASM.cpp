@@ -1,354 +1,1086 @@
 //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-/*          
+/*
     Module: ReservationASM.cpp
-    Revision History: 
+    Revision History:
     Revision 2.0: 2025-08-02 – Updated by Tyler Lee
     Revision 1.0: 2025/07/18 - Original by Tyler Lee
-    Purpose: 
-        This module implements the Reservation Access Storage Manager (ASM) which 
-        provides low-level file operations for the ferry reservation system. It 
-        manages a binary file containing reservation records and supports CRUD 
-        operations (Create, Read, Update, Delete). The module uses a single file 
-        stream for efficient access and implements algorithms for record management 
-        including linear search for lookups and swap-with-last for deletions. 
+    Purpose:
+        This module implements the Reservation Access Storage Manager (ASM) which
+        provides low-level file operations for the ferry reservation system. It
+        manages one binary file of reservation records per sailing and supports
+        CRUD operations (Create, Read, Update, Delete). The module keeps each
+        file memory-mapped through RecordStore and implements algorithms for record
+        management including hashed lookups and tombstone deletes with
+        background compaction.
         Fee calculation is based on vehicle dimensions with tiered pricing.
-        
-        Data Structure: Binary file with fixed-size Reservation records
-        Algorithm: Linear search O(n) for lookups, swap-delete O(n) for removal
+
+        Data Structure: One file of fixed-size Reservation records per sailing
+                        (reservations/<sailing ID>.dat), listed in the partition
+                        directory reservations.dir, plus an on-disk hash index
+                        (reservations.idx) keyed by ReservationKey that gives a
+                        record's slot within its sailing's file, and a Bloom
+                        filter over reservation keys (reservations.bloom)
+        Reservation IDs are parsed into a ReservationKey (packed plate +
+        sailing code) once at the API boundary; from there hashing and
+        comparing a key are integer operations, and a record's key is read
+        from its packed form without decoding it. The key's sailing code
+        names the partition, so per-sailing counts, listings and deletes
+        never touch another sailing's records.
+        Lookups can return a RecordHandle (slot + generation + partition) so
+        a follow-up read, update or delete of the same record skips the ID lookup.
+        Check-in warm-up: a sailing about to load can be prepared, which
+        reads its reservations into an in-memory table keyed by packed
+        plate. Lookups on that sailing are served from the table, and
+        onboard changes are logged as usual but reach the sailing's file
+        in batches (write-back), at each log checkpoint, when the sailing
+        departs and at shutdown; the write-ahead log covers a crash in
+        between.
+        Concurrency: one reader-writer lock for the partitions, the
+        prepared tables, the filter and the index. Lookups, counts and scans share it, so reports run
+        alongside bookings; applying a logged change or compacting takes it
+        exclusively. Index and filter reads are positional/atomic, so
+        shared readers never disturb each other.
+
+        Algorithm: Bloom filter answers "definitely absent" without touching the
+                   index, hash index O(1) for ID lookups, O(1) tombstone delete with
+                   free-slot reuse, O(1) per-sailing count, O(k) per-sailing
+                   enumerate, and deleting a sailing's reservations drops its
+                   file (the directory rewrite is the commit point);
+                   every stored or removed record adjusts its sailing's report
+                   aggregates in SailingASM; a background task compacts a
+                   sailing's file once its tombstones pass the garbage threshold;
+                   a prepared sailing answers lookups with one in-memory hash
+                   probe and writes pending onboard changes in slot order
 */
 
 //============================================
 
+#include <algorithm>
+#include <cerrno>
 #include <iostream>
-#include <fstream>
-#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 #include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "ReservationASM.h"
 #include "Reservation.h"
+#include "BackgroundTasks.h"
+#include "BloomFilter.h"
+#include "HashIndex.h"
+#include "LittleEndian.h"
+#include "PartitionDirectory.h"
+#include "RecordFormat.h"
+#include "RecordStore.h"
+#include "ReservationKey.h"
+#include "SailingASM.h"
+#include "Units.h"
+#include "WriteAheadLog.h"
 #include <cstring>
 using namespace std;
 
 //============================================
 
-static fstream reservationFile;  // persistent file stream for reservation binary file operations
+using ReservationPartition = RecordStore<Reservation, ReservationCodec>;  // one sailing's packed records
+
+static unordered_map<uint32_t, unique_ptr<ReservationPartition>> partitions;  // sailing code -> its mapped file
+static PartitionDirectory partitionDirectory;  // sailing codes that have a file
+static HashIndex reservationIndex;  // reservation key -> record slot in its sailing's file
+static BloomFilter reservationFilter;  // reservation keys that may exist (never a false "no")
+
+// Check-in warm-up table of one prepared sailing. Every change to the
+// sailing's reservations is applied to it as well, so a plate missing from
+// it has no reservation on the sailing.
+struct PreparedReservation
+{
+    Reservation reservation;  // current contents; ahead of the file while pending
+    RecordHandle handle;      // the record's place in the sailing's file
+    bool pending = false;     // holds a change the file has not been given yet
+};
+
+struct PreparedSailing
+{
+    unordered_map<uint64_t, PreparedReservation> byPlate;  // packed plate -> reservation
+    vector<uint64_t> pendingPlates;                        // plates with pending changes, in change order
+};
+
+static unordered_map<uint32_t, PreparedSailing> preparedSailings;  // sailing code -> its table
+static void writeBackPreparedSailings();  // With the write path below
+
+// Guards the partitions, the prepared tables, the filter and the index:
+// shared for lookups and scans, exclusive for applied changes, write-backs
+// and the background compaction task
+static shared_mutex reservationMutex;
+
+static const char* RESERVATION_PARTITION_DIR = "reservations";
+static const char* RESERVATION_DIRECTORY_FILE = "reservations.dir";
+static const char* RESERVATION_INDEX_FILE = "reservations.idx";
+static const char* RESERVATION_FILTER_FILE = "reservations.bloom";
+
+// A batch lookup switches from one index probe per ID to a single pass over
+// a sailing's records once it holds more than one ID per this many of them
+static constexpr size_t BATCH_SCAN_RECORDS_PER_KEY = 256;
+
+// A prepared sailing writes its pending onboard changes back once this many build up
+static constexpr size_t PREPARED_WRITE_BACK_BATCH = 64;
 
 //-----------------------------------------------
-void initializeReservationStorage()
+// helper: key of a packed record (a tombstone gives an invalid key)
+static ReservationKey keyOfRecord(const ReservationRecord &record)
+{
+    char plate[sizeof(record.licensePlate) + 1] = {};
+    memcpy(plate, record.licensePlate, sizeof(record.licensePlate));
+    ReservationKey key;
+    key.sailing = loadLittleEndian<uint32_t>(record.sailing);
+    if (key.sailing != 0) encodePlate(plate, key.plate);  // The codec stores only encodable plates
+    return key;
+}
+
+//-----------------------------------------------
+// helper: key of an in-memory reservation (invalid if it cannot be stored)
+static ReservationKey keyOfReservation(const Reservation &r)
+{
+    ReservationKey key;
+    makeReservationKey(r.licensePlate, r.sailingID, key);
+    return key;
+}
+
+//-----------------------------------------------
+// helper: partition key of a sailing ID (0, which no partition has, if it does not encode)
+static uint32_t sailingCodeOf(const char* sailingID)
+{
+    uint32_t code = 0;
+    return encodeSailingID(sailingID, code) ? code : 0;
+}
+
+//-----------------------------------------------
+// helper: data file of a sailing's partition, e.g. reservations/ABC-15-08.dat
+static string partitionPath(uint32_t sailingCode)
+{
+    char sailingID[sizeof(Reservation::sailingID)];
+    decodeSailingID(sailingCode, sailingID);
+    return string(RESERVATION_PARTITION_DIR) + "/" + sailingID + ".dat";
+}
+
+//-----------------------------------------------
+// helper: the open partition of a sailing, or nullptr if it has no reservations file
+static ReservationPartition *findPartition(uint32_t sailingCode)
+{
+    auto it = partitions.find(sailingCode);
+    return it == partitions.end() ? nullptr : it->second.get();
+}
+
+//-----------------------------------------------
+// helper: the partition of a sailing, creating its file and listing it in
+// the directory if needed; caller holds reservationMutex exclusively
+static ReservationPartition *openPartition(uint32_t sailingCode)
 {
-    // Attempt to open existing reservation file for read/write binary operations
-    reservationFile.open("reservations.dat", ios::binary | ios::in | ios::out);
+    if (ReservationPartition *existing = findPartition(sailingCode)) return existing;
 
-    if (!reservationFile.is_open())  // File doesn't exist, create it
+    // The file exists before the directory names it, so a crash in between
+    // leaves only an unlisted file, which the next start deletes
+    auto store = make_unique<ReservationPartition>();
+    if (!store->open(partitionPath(sailingCode), true)) return nullptr;
+    if (!partitionDirectory.add(sailingCode))
     {
-        // Create new binary file using ofstream constructor
-        ofstream createFile("reservations.dat", ios::binary);
-        reservationFile.clear();  // Clear any error flags from failed open
-        createFile.close();
-        
-        // Reopen as bidirectional fstream for subsequent operations
-        reservationFile.open("reservations.dat", ios::binary | ios::in | ios::out);
-        if (!reservationFile.is_open())  // Creation failed
+        store->drop();
+        return nullptr;
+    }
+    return (partitions[sailingCode] = move(store)).get();
+}
+
+//-----------------------------------------------
+// helper: every record slot across the partitions, and the bytes they take.
+// The byte total is the data size the index and filter files are stamped with.
+static size_t totalRecordSlots()
+{
+    size_t slots = 0;
+    for (const auto &p : partitions) slots += p.second->size();
+    return slots;
+}
+
+static uint64_t totalRecordBytes()
+{
+    uint64_t bytes = 0;
+    for (const auto &p : partitions) bytes += p.second->byteSize();
+    return bytes;
+}
+
+//-----------------------------------------------
+// helper: true once initializeReservationStorage() has opened the directory and index
+static bool reservationStorageOpen()
+{
+    return reservationIndex.isOpen();
+}
+
+//-----------------------------------------------
+// helper: handle to the record in slot of a sailing's partition
+static RecordHandle partitionHandle(uint32_t sailingCode, const ReservationPartition &store, uint32_t slot)
+{
+    RecordHandle handle = store.handle(slot);
+    handle.partition = sailingCode;
+    return handle;
+}
+
+//-----------------------------------------------
+// helper: the partition holding the record a handle names, or nullptr if
+// the handle is stale (record deleted or moved, or its sailing dropped)
+static ReservationPartition *resolveHandle(const RecordHandle &handle)
+{
+    ReservationPartition *store = findPartition(handle.partition);
+    return store != nullptr && store->isCurrent(handle) ? store : nullptr;
+}
+
+//-----------------------------------------------
+// helper: visit the key of every live record of one partition, straight from the packed blocks
+template <typename Fn>
+static void forEachLiveKey(const ReservationPartition &store, Fn fn)
+{
+    store.scanBlocks([&](const ReservationRecord *block, size_t firstSlot, size_t n) {
+        for (size_t i = 0; i < n; ++i)
         {
-            cerr << "Failed to create reservation file." << endl;
+            if (ReservationCodec::isLive(block[i])) fn(firstSlot + i, keyOfRecord(block[i]));
         }
+        return true;
+    });
+}
+
+//-----------------------------------------------
+// helper: resolve a key to its partition and slot through the hash index
+// and confirm the record at that slot really carries the key. The Bloom
+// filter answers most "not found" cases (e.g. duplicate checks) on its
+// own, and a sailing without a file needs no index probe.
+// probeReservationIndex is the index half, for keys the filter let through.
+static bool probeReservationIndex(const ReservationKey &key, ReservationPartition *&store, uint32_t &slot)
+{
+    store = findPartition(key.sailing);
+    bool found = store != nullptr &&
+                 reservationIndex.find(key, slot) &&
+                 slot < store->size() &&
+                 keyOfRecord(store->packed(slot)) == key;
+    if (!found) reservationFilter.recordFalsePositive();  // The filter said "maybe"
+    return found;
+}
+
+static bool findReservationSlot(const ReservationKey &key, ReservationPartition *&store, uint32_t &slot)
+{
+    if (!reservationStorageOpen() || !key.isValid()) return false;
+    if (!reservationFilter.mayContain(key.hash())) return false;  // Definitely absent
+    return probeReservationIndex(key, store, slot);
+}
+
+//-----------------------------------------------
+// helper: true if the handle still names the record with this key
+static bool handleNamesReservation(const RecordHandle &handle, const ReservationKey &key)
+{
+    ReservationPartition *store = handle.partition == key.sailing ? resolveHandle(handle) : nullptr;
+    return store != nullptr && keyOfRecord(store->packed(handle.slot)) == key;
+}
+
+//-----------------------------------------------
+// helper: rebuild reservations.idx from a full pass over every partition
+static bool rebuildReservationIndex()
+{
+    size_t live = 0;
+    for (const auto &p : partitions) live += p.second->liveCount();
+    if (!reservationIndex.rebuild(static_cast<uint32_t>(live))) return false;
+
+    bool ok = true;
+    for (const auto &p : partitions)
+    {
+        forEachLiveKey(*p.second, [&](size_t slot, const ReservationKey &key) {
+            ok = ok && reservationIndex.insert(key, static_cast<uint32_t>(slot));
+        });
     }
+    return ok;
 }
 
 //-----------------------------------------------
-void shutdownReservationStorage()
+// helper: rebuild the Bloom filter from a full pass over every partition.
+// Also the only way to forget deleted keys.
+static void rebuildReservationFilter()
 {
-    if (reservationFile.is_open())  // Prevent closing unopened file
+    size_t live = 0;
+    for (const auto &p : partitions) live += p.second->liveCount();
+    reservationFilter.rebuild(live);
+    for (const auto &p : partitions)
     {
-        reservationFile.close();  // Flush buffers and release file handle
+        forEachLiveKey(*p.second, [](size_t, const ReservationKey &key) { reservationFilter.add(key.hash()); });
     }
 }
 
 //-----------------------------------------------
-bool addReservation(const Reservation &r)
+// helper: add or remove a record's share of its sailing's report aggregates
+static void aggregateAdjust(const Reservation &r, int delta)
 {
-    if (!reservationFile.is_open())  // Validate file state before operation
+    adjustSailingAggregate(r.sailingID, r.reservedLane, r.vehicleLength, delta);
+}
+
+//-----------------------------------------------
+// helper: the table of a prepared sailing, or nullptr if it is not prepared
+static PreparedSailing *findPreparedSailing(uint32_t sailingCode)
+{
+    auto it = preparedSailings.find(sailingCode);
+    return it == preparedSailings.end() ? nullptr : &it->second;
+}
+
+//-----------------------------------------------
+// helper: a record as lookups see it: a prepared sailing's table may hold
+// a change its file has not been given yet
+static Reservation currentReservation(uint32_t sailingCode, const ReservationPartition &store, uint32_t slot)
+{
+    if (const PreparedSailing *sailing = findPreparedSailing(sailingCode))
     {
-        cerr << "Error: reservation file is not open." << endl;
-        return false;
+        auto entry = sailing->byPlate.find(keyOfRecord(store.packed(slot)).plate);
+        if (entry != sailing->byPlate.end()) return entry->second.reservation;
+    }
+    return store.at(slot);
+}
+
+//-----------------------------------------------
+// helper: background task that drops tombstones from one sailing's file.
+// Compaction renumbers that file's slots, so its records are repointed in
+// the index; the filter is rebuilt so it stops answering "maybe" for
+// deleted IDs.
+static void compactReservationPartition(uint32_t sailingCode)
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
+    ReservationPartition *store = findPartition(sailingCode);  // Gone if the sailing was dropped meanwhile
+    if (store == nullptr || !store->needsCompaction()) return;
+
+    if (!store->compact())
+    {
+        cerr << "Error: Failed to compact reservation file." << endl;
+        return;
+    }
+    bool ok = true;
+    PreparedSailing *prepared = findPreparedSailing(sailingCode);
+    forEachLiveKey(*store, [&](size_t slot, const ReservationKey &key) {
+        ok = ok && reservationIndex.update(key, static_cast<uint32_t>(slot));
+        if (prepared == nullptr) return;
+        auto entry = prepared->byPlate.find(key.plate);
+        if (entry != prepared->byPlate.end()) entry->second.handle = partitionHandle(sailingCode, *store, static_cast<uint32_t>(slot));
+    });
+    if (!ok && !rebuildReservationIndex())
+    {
+        cerr << "Failed to build reservation index." << endl;
     }
-    reservationFile.clear();  // Clear any previous EOF or error flags
-    // Position write pointer at end for append operation
-    reservationFile.seekp(0, ios::end);
+    rebuildReservationFilter();
+}
+
+//-----------------------------------------------
+// helper: delete the record in slot of a sailing's partition, keeping the
+// index consistent. The slot becomes a tombstone; no other record moves.
+static void removeReservationSlot(uint32_t sailingCode, ReservationPartition &store, uint32_t slot)
+{
+    const ReservationKey key = keyOfRecord(store.packed(slot));
+    if (PreparedSailing *prepared = findPreparedSailing(sailingCode)) prepared->byPlate.erase(key.plate);
+    reservationIndex.erase(key);
+    aggregateAdjust(store.at(slot), -1);
+    store.erase(slot);
 
-    // Write entire Reservation struct as binary data block
-    // Uses reinterpret_cast to convert struct pointer to char* for binary write
-    reservationFile.write(reinterpret_cast<const char*>(&r), sizeof(Reservation));
-    reservationFile.flush();
-    // Return success status based on stream state
-    return reservationFile.good();
+    if (store.needsCompaction())
+    {
+        scheduleBackgroundTask(partitionPath(sailingCode), [sailingCode]() { compactReservationPartition(sailingCode); });
+    }
 }
 
 //-----------------------------------------------
-bool deleteReservation(const std::string &id)
+// helper: delete files in the partition folder that no listed partition
+// owns: a partition created or dropped by a crashed run, or a compaction
+// copy it never swapped in
+static void removeUnlistedPartitionFiles()
 {
-    if (!reservationFile.is_open()) return false;
-    
-    reservationFile.clear();  // Clear any error/EOF flags
-    reservationFile.seekg(0, ios::beg);  // Position at file start
+    DIR *dir = opendir(RESERVATION_PARTITION_DIR);
+    if (dir == nullptr) return;
+
+    vector<string> owned;
+    for (uint32_t code : partitionDirectory.keys())
+    {
+        owned.push_back(partitionPath(code));
+        owned.push_back(partitionPath(code) + ".free");
+    }
+    // Loop goal: unlink every regular file the directory does not name
+    while (dirent *entry = readdir(dir))
+    {
+        if (entry->d_name[0] == '.') continue;
+        string path = string(RESERVATION_PARTITION_DIR) + "/" + entry->d_name;
+        if (find(owned.begin(), owned.end(), path) == owned.end()) unlink(path.c_str());
+    }
+    closedir(dir);
+}
 
-    streampos targetPosition = -1;  // position of record to delete
-    streampos lastRecordPosition;   // position of last record in file
-    Reservation currentRecord;
+//-----------------------------------------------
+void initializeReservationStorage()
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
 
-    // Linear search through file to find target record and track last position
-    while (reservationFile.read(reinterpret_cast<char*>(&currentRecord), sizeof(Reservation)))
+    // The directory lists every sailing that has a file; files it does not
+    // list are crash leftovers. New reservations fill cancelled slots
+    // before a file grows.
+    if ((mkdir(RESERVATION_PARTITION_DIR, 0755) != 0 && errno != EEXIST) ||
+        !partitionDirectory.open(RESERVATION_DIRECTORY_FILE))
     {
-        streampos recordPosition = reservationFile.tellg() - static_cast<streamoff>(sizeof(Reservation));
-        
-        if (id == currentRecord.licensePlate)  // Found target record
+        cerr << "Failed to create reservation file." << endl;
+        return;
+    }
+    removeUnlistedPartitionFiles();
+    for (uint32_t code : partitionDirectory.keys())
+    {
+        auto store = make_unique<ReservationPartition>();
+        if (!store->open(partitionPath(code), true))
         {
-            targetPosition = recordPosition;
+            cerr << "Failed to open reservation file " << partitionPath(code) << "." << endl;
+            partitions.clear();
+            partitionDirectory.close();
+            return;
         }
-        lastRecordPosition = recordPosition;  // Update last known position
+        partitions[code] = move(store);
     }
 
-    if (targetPosition == -1) return false;  // Record not found
+    // Reuse the hash index if it matches the data files, otherwise rebuild it
+    if (!reservationIndex.open(RESERVATION_INDEX_FILE, totalRecordBytes()))
+    {
+        if (!rebuildReservationIndex())
+        {
+            cerr << "Failed to build reservation index." << endl;
+        }
+    }
 
-    // Implement swap-with-last deletion algorithm to avoid shifting all records
-    if (targetPosition != lastRecordPosition)  // Not deleting the last record
+    // Same for the Bloom filter
+    if (!reservationFilter.open(RESERVATION_FILTER_FILE, totalRecordBytes()))
     {
-        // Read the last record from file
-        reservationFile.seekg(lastRecordPosition);
-        Reservation lastRecord;
-        reservationFile.read(reinterpret_cast<char*>(&lastRecord), sizeof(Reservation));
+        rebuildReservationFilter();
+    }
 
-        // Overwrite target record with last record data
-        reservationFile.seekp(targetPosition);
-        reservationFile.write(reinterpret_cast<const char*>(&lastRecord), sizeof(Reservation));
+    // Seed the sailing report aggregates with every stored reservation
+    resetSailingAggregates();
+    for (const auto &p : partitions)
+    {
+        p.second->forEachLive([](size_t, const Reservation &r) { aggregateAdjust(r, +1); });
     }
+}
 
-    // Truncate file to remove the now-duplicate last record
-    reservationFile.close();
-    size_t newFileSize = static_cast<size_t>(lastRecordPosition);
-    filesystem::resize_file("reservations.dat", newFileSize);
+//-----------------------------------------------
+void shutdownReservationStorage()
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
+    writeBackPreparedSailings();
+    preparedSailings.clear();
+    uint64_t finalSize = totalRecordBytes();
+    for (auto &p : partitions)
+    {
+        p.second->close();  // Flush mapping and trim file to its records
+    }
+    partitions.clear();
+    partitionDirectory.close();
+    reservationIndex.close(finalSize);  // Mark index clean for next startup
+    reservationFilter.close(finalSize);
+}
 
-    // Reopen file for subsequent operations
-    reservationFile.open("reservations.dat", ios::binary | ios::in | ios::out);
-    return true;
+//-----------------------------------------------
+// helper: overwrite the record in slot with a new version of it (same ID)
+static void rewriteReservationSlot(ReservationPartition &store, uint32_t slot, const Reservation &r)
+{
+    aggregateAdjust(store.at(slot), -1);
+    store.write(slot, r);
+    aggregateAdjust(r, +1);
 }
 
 //-----------------------------------------------
-bool deleteReservationsBySailingID(const std::string &sailingID)
+// helper: insert or replace a reservation by ID; caller holds reservationMutex exclusively
+static bool putReservationLocked(const Reservation &r)
 {
-    if (!reservationFile.is_open()) return false;
+    const ReservationKey key = keyOfReservation(r);
+    if (!key.isValid()) return false;  // No packed form to store
 
-    reservationFile.clear();  // Reset stream state
-    reservationFile.seekg(0, ios::beg);  // Start from beginning
+    ReservationPartition *store;
+    uint32_t slot;
+    PreparedSailing *prepared = findPreparedSailing(key.sailing);
+    if (findReservationSlot(key, store, slot))  // Existing record: rewrite in place
+    {
+        rewriteReservationSlot(*store, slot, r);
+        if (prepared != nullptr) prepared->byPlate[key.plate] = {r, partitionHandle(key.sailing, *store, slot), false};
+        return true;
+    }
 
-    std::vector<Reservation> recordsToKeep;  // temporary storage for non-matching records
-    Reservation currentReservation;
+    // Append the record to its sailing's mapped file
+    store = openPartition(key.sailing);
+    size_t newSlot;
+    if (store == nullptr || !store->append(r, &newSlot)) return false;
+    aggregateAdjust(r, +1);
+    if (prepared != nullptr)
+    {
+        prepared->byPlate[key.plate] = {r, partitionHandle(key.sailing, *store, static_cast<uint32_t>(newSlot)), false};
+    }
 
-    // Read all records and collect those that don't match the target sailing ID
-    while (reservationFile.read(reinterpret_cast<char*>(&currentReservation), sizeof(Reservation)))
+    // Past its sized capacity the filter is rebuilt larger rather than left to fill up
+    reservationFilter.add(key.hash());
+    if (reservationFilter.isSaturated()) rebuildReservationFilter();
+
+    // Keep the hash index in step with the data files
+    return reservationIndex.insert(key, static_cast<uint32_t>(newSlot));
+}
+
+//-----------------------------------------------
+// helper: give a prepared sailing's file every pending change, in slot
+// order so the writes walk the mapping sequentially; a record moved since
+// it was prepared (compaction) is found again by key.
+// Caller holds reservationMutex exclusively.
+static void writeBackPreparedSailing(uint32_t sailingCode, PreparedSailing &sailing)
+{
+    vector<PreparedReservation*> batch;
+    for (uint64_t plate : sailing.pendingPlates)
     {
-        if (sailingID != currentReservation.sailingID)  // Keep records for other sailings
-        {
-            recordsToKeep.push_back(currentReservation);
-        }
-        // Records matching sailingID are implicitly discarded (not added to vector)
+        auto entry = sailing.byPlate.find(plate);
+        if (entry == sailing.byPlate.end() || !entry->second.pending) continue;  // Deleted or rewritten since
+        entry->second.pending = false;
+        batch.push_back(&entry->second);
     }
+    sailing.pendingPlates.clear();
+    sort(batch.begin(), batch.end(), [](const PreparedReservation *a, const PreparedReservation *b) {
+        return a->handle.slot < b->handle.slot;
+    });
 
-    // Rewrite entire file with only the records to keep
-    reservationFile.close();
-    ofstream rewriteFile("reservations.dat", ios::binary | ios::trunc);  // Truncate existing file
-    if (!rewriteFile.is_open()) return false;
-    
-    // Write each kept record back to file
-    for (const auto& record : recordsToKeep)  // Iterate through preserved records
+    ReservationPartition *store = findPartition(sailingCode);
+    for (PreparedReservation *entry : batch)
     {
-        rewriteFile.write(reinterpret_cast<const char*>(&record), sizeof(Reservation));
-        if (!rewriteFile.good())  // Check for write errors
+        if (store != nullptr && store->isCurrent(entry->handle))
         {
-            rewriteFile.close();
-            return false;
+            rewriteReservationSlot(*store, entry->handle.slot, entry->reservation);
+        }
+        else
+        {
+            putReservationLocked(entry->reservation);
         }
     }
-    rewriteFile.close();
+}
 
-    // Reopen as fstream for subsequent operations
-    reservationFile.open("reservations.dat", ios::binary | ios::in | ios::out);
-    return reservationFile.is_open();
+//-----------------------------------------------
+// helper: write back every prepared sailing; caller holds reservationMutex exclusively
+static void writeBackPreparedSailings()
+{
+    for (auto &p : preparedSailings)
+    {
+        writeBackPreparedSailing(p.first, p.second);
+    }
 }
 
 //-----------------------------------------------
-std::optional<Reservation> getReservationByID(const char* reservationID)
+// helper: record a change to a prepared reservation in its table only, to
+// be written back with the next batch. Only changes that leave the report
+// aggregates alone (same lane and length) wait; anything else is applied
+// at once. Caller holds reservationMutex exclusively.
+static bool deferPreparedChange(const ReservationKey &key, const Reservation &r)
 {
-    if (!reservationFile.is_open())  // Validate file accessibility
-        return std::nullopt;
+    PreparedSailing *sailing = findPreparedSailing(key.sailing);
+    if (sailing == nullptr) return false;
+    auto entry = sailing->byPlate.find(key.plate);
+    if (entry == sailing->byPlate.end() || entry->second.reservation.reservedLane != r.reservedLane ||
+        entry->second.reservation.vehicleLength != r.vehicleLength)
+    {
+        return false;
+    }
 
-    reservationFile.clear();  // Clear any EOF/error flags from previous operations
-    reservationFile.seekg(0, std::ios::beg);  // Position at file start
+    entry->second.reservation = r;
+    if (!entry->second.pending)
+    {
+        entry->second.pending = true;
+        sailing->pendingPlates.push_back(key.plate);
+    }
+    if (sailing->pendingPlates.size() >= PREPARED_WRITE_BACK_BATCH) writeBackPreparedSailing(key.sailing, *sailing);
+    return true;
+}
 
-    Reservation tempRecord;
-    
-    while (reservationFile.read(reinterpret_cast<char*>(&tempRecord), sizeof(Reservation)))
+//-----------------------------------------------
+// helper: delete a reservation by key if present; caller holds reservationMutex exclusively
+static void deleteReservationLocked(const ReservationKey &key)
+{
+    ReservationPartition *store;
+    uint32_t targetSlot;
+    if (findReservationSlot(key, store, targetSlot))
     {
-        if (strncmp(tempRecord.id, reservationID, sizeof(tempRecord.id)) == 0)  // Found matching reservation
+        removeReservationSlot(key.sailing, *store, targetSlot);  // O(1) tombstone
+    }
+}
+
+//-----------------------------------------------
+// helper: insert or replace a reservation by ID (WAL RESERVATION_PUT)
+static bool applyReservationPut(const Reservation &r)
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
+    return putReservationLocked(r);
+}
+
+//-----------------------------------------------
+// helper: delete a reservation by ID if present (WAL RESERVATION_DELETE)
+static bool applyReservationDelete(const char* id)
+{
+    ReservationKey key;
+    if (!parseReservationID(id, key)) return true;  // Names no stored reservation
+
+    unique_lock<shared_mutex> lock(reservationMutex);
+    deleteReservationLocked(key);
+    return true;
+}
+
+//-----------------------------------------------
+// helper: RESERVATION_PUT through a handle: one positional write while the
+// handle is current, otherwise (e.g. compaction ran before the commit) by ID
+static bool applyReservationPutAt(const RecordHandle &handle, const Reservation &r)
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
+    if (deferPreparedChange(keyOfReservation(r), r)) return true;  // Written back with the sailing's next batch
+    if (!handleNamesReservation(handle, keyOfReservation(r))) return putReservationLocked(r);
+    rewriteReservationSlot(*findPartition(handle.partition), handle.slot, r);
+    return true;
+}
+
+//-----------------------------------------------
+// helper: RESERVATION_DELETE through a handle, falling back to the key
+static bool applyReservationDeleteAt(const RecordHandle &handle, const ReservationKey &key)
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
+    if (handleNamesReservation(handle, key))
+    {
+        removeReservationSlot(key.sailing, *findPartition(key.sailing), handle.slot);
+    }
+    else
+    {
+        deleteReservationLocked(key);
+    }
+    return true;
+}
+
+//-----------------------------------------------
+// helper: delete every reservation of a sailing (WAL RESERVATIONS_DELETE_BY_SAILING)
+// by dropping its partition: once the directory no longer lists it the
+// delete is durable, and the file is simply unlinked
+static bool applyReservationsDeleteBySailing(const char* sailingID)
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
+    const uint32_t code = sailingCodeOf(sailingID);
+    ReservationPartition *store = findPartition(code);
+    if (store == nullptr) return true;  // No reservations on this sailing
+
+    if (!partitionDirectory.remove(code)) return false;  // Nothing dropped yet
+    preparedSailings.erase(code);  // Pending changes die with the records
+    store->forEachLive([&](size_t slot, const Reservation &r) {
+        reservationIndex.erase(keyOfRecord(store->packed(slot)));
+        aggregateAdjust(r, -1);
+    });
+    store->drop();
+    partitions.erase(code);
+    return true;
+}
+
+//-----------------------------------------------
+bool applyReservationLogOperation(WalOp op, const char* payload, std::size_t length)
+{
+    switch (op)
+    {
+        case WalOp::RESERVATION_PUT:
+        {
+            if (length != sizeof(Reservation)) return false;
+            Reservation r;
+            memcpy(&r, payload, sizeof(r));
+            return applyReservationPut(r);
+        }
+        case WalOp::RESERVATION_DELETE:
         {
-            return tempRecord;  // Return copy of found record
+            char id[sizeof(Reservation::id)] = {};
+            memcpy(id, payload, min(length, sizeof(id) - 1));
+            return applyReservationDelete(id);
         }
+        case WalOp::RESERVATIONS_DELETE_BY_SAILING:
+        {
+            char sailingID[sizeof(Reservation::sailingID)] = {};
+            memcpy(sailingID, payload, min(length, sizeof(sailingID) - 1));
+            return applyReservationsDeleteBySailing(sailingID);
+        }
+        default:
+            return true;  // Not a reservation operation
     }
+}
 
-    return std::nullopt;  // No matching record found
+//-----------------------------------------------
+void syncReservationStorage()
+{
+    unique_lock<shared_mutex> lock(reservationMutex);  // Write-back changes the prepared tables
+    writeBackPreparedSailings();
+    for (auto &p : partitions)
+    {
+        p.second->sync();
+    }
 }
 
 //-----------------------------------------------
-std::optional<Reservation> getReservationByLicenseAndID(const char* reservationID)
+bool addReservation(const Reservation &r)
 {
-    if (!reservationFile.is_open())
+    if (!reservationStorageOpen())  // Validate file state before operation
+    {
+        cerr << "Error: reservation file is not open." << endl;
+        return false;
+    }
+
+    // Log first; the record reaches its sailing's file once the transaction commits
+    return logMutation(WalOp::RESERVATION_PUT, &r, sizeof(r), [r]() { return applyReservationPut(r); });
+}
+
+//-----------------------------------------------
+bool deleteReservation(const std::string &id)
+{
+    RecordHandle handle;
+    if (!getReservationByID(id.c_str(), handle)) return false;  // Record not found
+    return deleteReservation(handle);
+}
+
+//-----------------------------------------------
+bool deleteReservation(const RecordHandle &handle)
+{
+    shared_lock<shared_mutex> lock(reservationMutex);
+    ReservationPartition *store = resolveHandle(handle);
+    if (store == nullptr) return false;  // Deleted or moved since the lookup
+
+    const ReservationKey key = keyOfRecord(store->packed(handle.slot));
+    lock.unlock();
+
+    // The log carries the ID text; replay parses it back into the key
+    char id[sizeof(Reservation::id)] = {};
+    formatReservationID(key, id);
+    return logMutation(WalOp::RESERVATION_DELETE, id, sizeof(id),
+                       [handle, key]() { return applyReservationDeleteAt(handle, key); });
+}
+
+//-----------------------------------------------
+bool deleteReservationsBySailingID(const std::string &sailingID)
+{
+    if (!reservationStorageOpen()) return false;
+
+    char key[sizeof(Reservation::sailingID)] = {};
+    strncpy(key, sailingID.c_str(), sizeof(key) - 1);
+    return logMutation(WalOp::RESERVATIONS_DELETE_BY_SAILING, key, sizeof(key),
+                       [sailingID]() { return applyReservationsDeleteBySailing(sailingID.c_str()); });
+}
+
+//-----------------------------------------------
+std::vector<Reservation> getReservationsBySailing(const char* sailingID)
+{
+    shared_lock<shared_mutex> lock(reservationMutex);
+    std::vector<Reservation> result;
+    const uint32_t code = sailingCodeOf(sailingID);
+    ReservationPartition *store = findPartition(code);
+    if (store == nullptr) return result;
+
+    // The sailing's own file holds nothing else: one sequential pass, in
+    // file order, with a prepared sailing's pending changes laid over it
+    result.reserve(store->liveCount());
+    const bool prepared = findPreparedSailing(code) != nullptr;
+    store->forEachLive([&](size_t slot, const Reservation &r) {
+        result.push_back(prepared ? currentReservation(code, *store, static_cast<uint32_t>(slot)) : r);
+    });
+    return result;
+}
+
+//-----------------------------------------------
+std::optional<Reservation> getReservationByID(const char* reservationID)
+{
+    RecordHandle handle;
+    return getReservationByID(reservationID, handle);
+}
+
+//-----------------------------------------------
+std::optional<Reservation> getReservationByID(const char* reservationID, RecordHandle &handle)
+{
+    ReservationKey key;
+    parseReservationID(reservationID, key);  // An unparsable ID gives an invalid key: not found
+    return getReservationByKey(key, handle);
+}
+
+//-----------------------------------------------
+std::optional<Reservation> getReservationByKey(const ReservationKey &key, RecordHandle &handle)
+{
+    shared_lock<shared_mutex> lock(reservationMutex);
+    if (const PreparedSailing *prepared = findPreparedSailing(key.sailing))  // One in-memory probe
+    {
+        auto entry = prepared->byPlate.find(key.plate);
+        if (entry == prepared->byPlate.end()) return std::nullopt;
+        handle = entry->second.handle;
+        return entry->second.reservation;
+    }
+
+    ReservationPartition *store;
+    uint32_t slot;
+    if (!findReservationSlot(key, store, slot))  // Index probe + one record read
         return std::nullopt;
 
-    reservationFile.clear();
-    reservationFile.seekg(0, std::ios::beg);
+    handle = partitionHandle(key.sailing, *store, slot);
+    return store->at(slot);  // Return copy of found record
+}
 
-    Reservation tempRecord;
-    
-    while (reservationFile.read(reinterpret_cast<char*>(&tempRecord), sizeof(Reservation)))
-    {
-        // Create composite key from the record using C-style string concatenation
-        char recordCompositeKey[21]; // licensePlate (10) + sailingID (10) + null terminator
-        snprintf(recordCompositeKey, sizeof(recordCompositeKey), "%s%s", 
-                 tempRecord.licensePlate, tempRecord.sailingID);
-        
-        if (strcmp(recordCompositeKey, reservationID) == 0)  // Compare C-style strings
+//-----------------------------------------------
+std::vector<std::optional<Reservation>> getReservationsByIDs(const char* const* reservationIDs, std::size_t count,
+                                                             std::vector<RecordHandle> *handles)
+{
+    std::vector<ReservationKey> keys(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        parseReservationID(reservationIDs[i], keys[i]);
+    }
+    return getReservationsByKeys(keys.data(), count, handles);
+}
+
+//-----------------------------------------------
+std::vector<std::optional<Reservation>> getReservationsByKeys(const ReservationKey* keys, std::size_t count,
+                                                              std::vector<RecordHandle> *handles)
+{
+    shared_lock<shared_mutex> lock(reservationMutex);
+    std::vector<std::optional<Reservation>> result(count);
+    if (handles != nullptr) handles->assign(count, RecordHandle{});
+    if (!reservationStorageOpen()) return result;
+
+    // Keys of prepared sailings are answered from their tables; the Bloom
+    // filter removes keys that cannot exist before any record is read
+    std::vector<pair<ReservationKey, size_t>> wanted;  // (key, position in keys)
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (const PreparedSailing *prepared = findPreparedSailing(keys[i].sailing))
+        {
+            auto entry = prepared->byPlate.find(keys[i].plate);
+            if (entry == prepared->byPlate.end()) continue;
+            result[i] = entry->second.reservation;
+            if (handles != nullptr) (*handles)[i] = entry->second.handle;
+        }
+        else if (keys[i].isValid() && reservationFilter.mayContain(keys[i].hash()))
+        {
+            wanted.emplace_back(keys[i], i);
+        }
+    }
+
+    auto take = [&](size_t i, uint32_t sailingCode, const ReservationPartition &store, uint32_t slot) {
+        result[i] = store.at(slot);
+        if (handles != nullptr) (*handles)[i] = partitionHandle(sailingCode, store, slot);
+    };
+
+    // Few keys: one index probe each
+    if (wanted.size() * BATCH_SCAN_RECORDS_PER_KEY < totalRecordSlots())
+    {
+        for (const auto &w : wanted)
         {
-            return tempRecord;
+            ReservationPartition *store;
+            uint32_t slot;
+            if (probeReservationIndex(w.first, store, slot)) take(w.second, w.first.sailing, *store, slot);
         }
+        return result;
     }
 
-    return std::nullopt;
+    // Many keys: group them by sailing, sorted within each, and look up the
+    // key of every record of one sequential pass over each named sailing's
+    // packed blocks, without decoding the misses; other sailings are not read
+    auto bySailing = [](const pair<ReservationKey, size_t> &a, const pair<ReservationKey, size_t> &b) {
+        return a.first.sailing != b.first.sailing ? a.first.sailing < b.first.sailing : a.first < b.first;
+    };
+    sort(wanted.begin(), wanted.end(), bySailing);
+    for (auto group = wanted.begin(); group != wanted.end();)
+    {
+        const uint32_t code = group->first.sailing;
+        auto groupEnd = find_if(group, wanted.end(), [code](const pair<ReservationKey, size_t> &w) { return w.first.sailing != code; });
+        if (const ReservationPartition *store = findPartition(code))
+        {
+            forEachLiveKey(*store, [&](size_t slot, const ReservationKey &recordKey) {
+                auto range = equal_range(group, groupEnd, make_pair(recordKey, size_t{0}), bySailing);
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (!result[it->second]) take(it->second, code, *store, static_cast<uint32_t>(slot));  // First record wins, like the index
+                }
+            });
+        }
+        group = groupEnd;
+    }
+    for (const auto &w : wanted)
+    {
+        if (!result[w.second]) reservationFilter.recordFalsePositive();
+    }
+    return result;
 }
 
+//-----------------------------------------------
+std::optional<Reservation> getReservation(const RecordHandle &handle)
+{
+    shared_lock<shared_mutex> lock(reservationMutex);
+    ReservationPartition *store = resolveHandle(handle);
+    if (store == nullptr) return std::nullopt;
+    return currentReservation(handle.partition, *store, handle.slot);
+}
 
 //-----------------------------------------------
-double calculateFee(const std::string &reservationID, const Date & /*actualReturnDate*/)
+bool updateReservation(const RecordHandle &handle, const Reservation &r)
 {
-    auto reservationOption = getReservationByID(reservationID.c_str());
-    if (!reservationOption.has_value()) return -1.0;  // Reservation not found
+    {
+        shared_lock<shared_mutex> lock(reservationMutex);
+        if (!handleNamesReservation(handle, keyOfReservation(r))) return false;  // Stale handle or ID changed
+    }
+    return logMutation(WalOp::RESERVATION_PUT, &r, sizeof(r), [handle, r]() { return applyReservationPutAt(handle, r); });
+}
+
+//-----------------------------------------------
+BloomFilterStats getReservationFilterStats()
+{
+    shared_lock<shared_mutex> lock(reservationMutex);
+    return reservationFilter.statistics();
+}
+
+//-----------------------------------------------
+int prepareSailingCheckIn(const char* sailingID)
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
+    const uint32_t code = sailingCodeOf(sailingID);
+    if (!reservationStorageOpen() || code == 0) return -1;
+
+    // Preparing again reloads the table from the file, after writing it back
+    PreparedSailing &prepared = preparedSailings[code];
+    writeBackPreparedSailing(code, prepared);
+    prepared.byPlate.clear();
+
+    ReservationPartition *store = findPartition(code);
+    if (store == nullptr) return 0;  // No reservations yet; bookings made now land in the table
+    prepared.byPlate.reserve(store->liveCount());
+    store->forEachLive([&](size_t slot, const Reservation &r) {
+        prepared.byPlate[keyOfRecord(store->packed(slot)).plate] = {r, partitionHandle(code, *store, static_cast<uint32_t>(slot)), false};
+    });
+    return static_cast<int>(prepared.byPlate.size());
+}
+
+//-----------------------------------------------
+void releaseSailingCheckIn(const char* sailingID)
+{
+    unique_lock<shared_mutex> lock(reservationMutex);
+    const uint32_t code = sailingCodeOf(sailingID);
+    PreparedSailing *prepared = findPreparedSailing(code);
+    if (prepared == nullptr) return;
+
+    writeBackPreparedSailing(code, *prepared);
+    preparedSailings.erase(code);
+}
 
+//-----------------------------------------------
+std::optional<Reservation> getReservationByLicenseAndID(const char* reservationID)
+{
+    // Only the plain composite key (plate + sailing ID, no '*' padding) is accepted
+    ReservationKey key;
+    if (strchr(reservationID, '*') != nullptr || !parseReservationID(reservationID, key)) return std::nullopt;
+
+    RecordHandle handle;
+    return getReservationByKey(key, handle);
+}
+
+//-----------------------------------------------
+// helper: fare for a reservation record already in hand
+static double feeForReservation(const Reservation &reservation)
+{
     // Fee structure constants based on business rules
     const double NORMAL_VEHICLE_FEE = 14.0;              // flat rate for standard vehicles
     const double LONG_LOW_SPECIAL_RATE = 2.0;            // per meter for long low vehicles
     const double LONG_OVERHEIGHT_SPECIAL_RATE = 3.0;     // per meter for long overheight vehicles
+    const int32_t LONG_LENGTH = 700;                     // centimetres
+    const int32_t LOW_HEIGHT = 200;                      // centimetres
 
     double calculatedFee = 0.0;
     
     // Tiered pricing algorithm based on vehicle dimensions
-    if (reservationOption->vehicleLength <= 7.0 && reservationOption->vehicleHeight <= 2.0)
+    if (reservation.vehicleLength <= LONG_LENGTH && reservation.vehicleHeight <= LOW_HEIGHT)
     {
         // Standard vehicle: flat fee regardless of exact dimensions
         calculatedFee = NORMAL_VEHICLE_FEE;
     } 
-    else if (reservationOption->vehicleLength > 7.0 && reservationOption->vehicleHeight <= 2.0)
+    else if (reservation.vehicleLength > LONG_LENGTH && reservation.vehicleHeight <= LOW_HEIGHT)
     {
         // Long but low vehicle: rate per meter of length
-        calculatedFee = reservationOption->vehicleLength * LONG_LOW_SPECIAL_RATE;
+        calculatedFee = toMetres(reservation.vehicleLength) * LONG_LOW_SPECIAL_RATE;
     }
-    else if (reservationOption->vehicleLength > 7.0 && reservationOption->vehicleHeight > 2.0)
+    else if (reservation.vehicleLength > LONG_LENGTH && reservation.vehicleHeight > LOW_HEIGHT)
     {
         // Long and tall vehicle: higher rate per meter due to space constraints
-        calculatedFee = reservationOption->vehicleLength * LONG_OVERHEIGHT_SPECIAL_RATE;
+        calculatedFee = toMetres(reservation.vehicleLength) * LONG_OVERHEIGHT_SPECIAL_RATE;
     }
 
     return calculatedFee;
 }
 
+//-----------------------------------------------
+double calculateFee(const std::string &reservationID, const Date & /*actualReturnDate*/)
+{
+    auto reservationOption = getReservationByID(reservationID.c_str());
+    if (!reservationOption.has_value()) return -1.0;  // Reservation not found
+    return feeForReservation(*reservationOption);
+}
+
 //-----------------------------------------------
 bool setOnboardStatus(const std::string &reservationID, bool onboardStatus)
 {
-    if (!reservationFile.is_open()) return false;
+    RecordHandle handle;
+    if (!getReservationByID(reservationID.c_str(), handle)) return false;  // Reservation ID not found
+    return setOnboardStatus(handle, onboardStatus);
+}
 
-    reservationFile.clear();  // Clear stream flags
-    reservationFile.seekg(0, ios::beg);  // Start search from beginning
+//-----------------------------------------------
+bool setOnboardStatus(const RecordHandle &handle, bool onboardStatus)
+{
+    shared_lock<shared_mutex> lock(reservationMutex);
+    ReservationPartition *store = resolveHandle(handle);
+    if (store == nullptr) return false;  // Deleted or moved since the lookup
 
-    Reservation recordBuffer;
-    
-    // Linear search for matching reservation ID
-    while (reservationFile.read(reinterpret_cast<char*>(&recordBuffer), sizeof(Reservation)))
-    {
-        streampos recordPosition = reservationFile.tellg() - static_cast<streamoff>(sizeof(Reservation));
-        
-        if (strncmp(recordBuffer.id, reservationID.c_str(), sizeof(recordBuffer.id)) == 0)  // Found target record
-        {
-            recordBuffer.onboard = onboardStatus;  // Update onboard flag
+    Reservation updated = currentReservation(handle.partition, *store, handle.slot);
+    updated.onboard = onboardStatus;  // Update onboard flag
+    lock.unlock();
 
-            // Write modified record back to same file position
-            reservationFile.seekp(recordPosition);
-            reservationFile.write(reinterpret_cast<const char*>(&recordBuffer), sizeof(Reservation));
-            return reservationFile.good();  // Return write success status
-        }
-    }
-
-    return false;  // Reservation ID not found
+    // Logged as a replacement of the whole record; applied as one positional
+    // write, or on a prepared sailing with the table's next write-back
+    return logMutation(WalOp::RESERVATION_PUT, &updated, sizeof(updated),
+                       [handle, updated]() { return applyReservationPutAt(handle, updated); });
 }
 
 //-----------------------------------------------
 bool getOnboardStatus(const std::string &reservationID)
 {
-    if (!reservationFile.is_open()) return false;
-
-    reservationFile.clear();  // Reset stream state
-    reservationFile.seekg(0, ios::beg);  // Position at file start
-
-    Reservation recordBuffer;
-    
-    // Linear search through records for matching ID
-    while (reservationFile.read(reinterpret_cast<char*>(&recordBuffer), sizeof(Reservation)))
+    RecordHandle handle;
+    auto reservationOption = getReservationByID(reservationID.c_str(), handle);
+    if (!reservationOption.has_value())
     {
-        if (recordBuffer.licensePlate == reservationID)  // Found matching record
-        {
-            return recordBuffer.onboard;  // Return current onboard status
-        }
+        return false;  // Not found or not onboard (default to false for safety)
     }
-
-    return false;  // Not found or not onboard (default to false for safety)
+    return reservationOption->onboard;  // Return current onboard status
 }
 
 //-----------------------------------------------
-double checkInAndCalcFee(const std::string &reservationID, const Date &actualReturnDate)
+double checkInAndCalcFee(const std::string &reservationID, const Date & /*actualReturnDate*/)
 {
-    // Calculate fee first to validate reservation exists
-    double feeAmount = calculateFee(reservationID, actualReturnDate);
-    
-    if (feeAmount >= 0)  // Valid reservation found and fee calculated
-    {
-        setOnboardStatus(reservationID, true);  // Mark vehicle as checked in
-    }
-    
-    return feeAmount;  // Return calculated fee or -1 if reservation not found
+    // One lookup validates the reservation and yields a handle for the update
+    RecordHandle handle;
+    auto reservationOption = getReservationByID(reservationID.c_str(), handle);
+    if (!reservationOption.has_value()) return -1.0;  // Reservation not found
+
+    double feeAmount = feeForReservation(*reservationOption);
+    setOnboardStatus(handle, true);  // Mark vehicle as checked in (positional write)
+    return feeAmount;  // Return calculated fee
 }
 
 //-----------------------------------------------
 int countReservationsBySailing(const char* targetSailingID)
 {
-    if (!reservationFile.is_open())  // Validate file state
+    shared_lock<shared_mutex> lock(reservationMutex);
+    if (!reservationStorageOpen())  // Validate file state
     {
         cerr << "Error: reservation file is not open.\n";
         return 0;
     }
 
-    reservationFile.clear();  // Clear any EOF/error flags
-    reservationFile.seekg(0, ios::beg);  // Position at file start
-
-    Reservation recordBuffer;
-    int matchingCount = 0;  // counter for reservations matching target sailing
-
-    // Linear scan through all records counting matches
-    while (reservationFile.read(reinterpret_cast<char*>(&recordBuffer), sizeof(Reservation)))
-    {
-        // Use strncmp for safe string comparison within fixed-size char array
-        if (strncmp(recordBuffer.sailingID, targetSailingID, sizeof(recordBuffer.sailingID)) == 0)
-        {
-            ++matchingCount;  // Increment counter for each match found
-        }
-    }
-
-    return matchingCount;
+    // The sailing's file holds only its reservations: its live count is the count
+    ReservationPartition *store = findPartition(sailingCodeOf(targetSailingID));
+    return store == nullptr ? 0 : static_cast<int>(store->liveCount());
 }
 
 //-----------------------------------------------
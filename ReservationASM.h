@@ -14,22 +14,42 @@
 
 #include <optional>
 #include <string>
+#include <vector>
+#include "BloomFilter.h"
+#include "RecordHandle.h"
 #include "Reservation.h"
+#include "ReservationKey.h"
+#include "WriteAheadLog.h"
 
 //-----------------------------------------------
 void initializeReservationStorage();
-//opens reservation binary file for read/write
-//creates file if doesnt exist
+//opens the reservation directory and every sailing's binary file for read/write
+//creates the directory if it doesnt exist
 
 //-----------------------------------------------
 void shutdownReservationStorage();
-// Close reservation binary file
+// Close every sailing's reservation binary file
+
+//-----------------------------------------------
+void syncReservationStorage();
+// Writes back prepared sailings' pending changes and forces every sailing's
+// reservation file to disk (write-ahead log checkpoint)
+
+//-----------------------------------------------
+bool applyReservationLogOperation(
+    WalOp op,                 // in: logged operation
+    const char* payload,      // in: operation payload
+    std::size_t length        // in: payload size in bytes
+);
+// re-applies one write-ahead log operation during startup replay
+// ignores operations that belong to other modules
 
 //-----------------------------------------------
 bool addReservation(
     const Reservation &r  // in: reservation to add
 );
-//appends reservation to end of binary file
+//appends reservation to end of its sailing's binary file (replaces an existing record with the same ID)
+//the change is logged first; inside a transaction it is applied on commit
 //returns true if write was succesfull
 
 //-----------------------------------------------
@@ -37,15 +57,28 @@ bool deleteReservation(
     const std::string &id  // in: ID of reservation to remove
 );
 //deletes reservation by id from binary file
-//if found overwrites the record with last record
+//if found marks the record's slot as a tombstone (no other record moves)
 //return true if successful else false if id not found or not open
 
+//-----------------------------------------------
+bool deleteReservation(
+    const RecordHandle &handle  // in: handle from a lookup
+);
+//deletes the record the handle names without searching for its ID
+//return false if the record was deleted or moved since the lookup
+
 //-----------------------------------------------
 bool deleteReservationsBySailingID(
     const std::string &sailingID  // in: sailing ID to remove
 );
 
-// removes all reservations for a given sailing
+// removes all reservations for a given sailing by dropping the sailing's file
+
+//-----------------------------------------------
+std::vector<Reservation> getReservationsBySailing(
+    const char* sailingID  // in: sailing ID to enumerate
+);
+// returns every reservation booked on the given sailing
 
 //-----------------------------------------------
 std::optional<Reservation> getReservationByID(
@@ -54,6 +87,76 @@ std::optional<Reservation> getReservationByID(
 //find reservation id by license plate
 //returns optional<Reservation> if found or nullopt otherwise
 
+//-----------------------------------------------
+std::optional<Reservation> getReservationByID(
+    const char* reservationID,  // in: ID to look up
+    RecordHandle &handle         // out: handle to the record if found
+);
+//same lookup, also returning a handle for follow-up reads/updates/deletes
+
+//-----------------------------------------------
+std::optional<Reservation> getReservationByKey(
+    const ReservationKey &key,  // in: key to look up (invalid: not found)
+    RecordHandle &handle         // out: handle to the record if found
+);
+//same lookup by key: no ID text is built or parsed
+
+//-----------------------------------------------
+std::vector<std::optional<Reservation>> getReservationsByIDs(
+    const char* const* reservationIDs,            // in: IDs to look up
+    std::size_t count,                            // in: number of IDs
+    std::vector<RecordHandle> *handles = nullptr  // out: handle per found ID (optional)
+);
+//resolves a whole batch of IDs at once; result[i] answers reservationIDs[i]
+//IDs the Bloom filter rules out cost nothing; the rest take one index probe
+//each, or, for a batch that is large next to the files, share one pass over
+//the file of each sailing the batch names
+
+//-----------------------------------------------
+std::vector<std::optional<Reservation>> getReservationsByKeys(
+    const ReservationKey* keys,                   // in: keys to look up
+    std::size_t count,                            // in: number of keys
+    std::vector<RecordHandle> *handles = nullptr  // out: handle per found key (optional)
+);
+//same batch lookup by key; result[i] answers keys[i]
+
+//-----------------------------------------------
+std::optional<Reservation> getReservation(
+    const RecordHandle &handle  // in: handle from a lookup
+);
+//reads the record in the handle's slot (no search)
+//returns nullopt if the record was deleted or moved since the lookup
+
+//-----------------------------------------------
+bool updateReservation(
+    const RecordHandle &handle,  // in: handle from a lookup
+    const Reservation &r         // in: new contents; must keep the same ID
+);
+//rewrites the record in place (logged like addReservation)
+//returns false if the handle is stale or r carries a different ID
+
+//-----------------------------------------------
+BloomFilterStats getReservationFilterStats();
+// Bloom filter counters for reservation ID lookups since startup (or the
+// last filter rebuild): queries, definite "not found" answers, false positives
+
+//-----------------------------------------------
+int prepareSailingCheckIn(
+    const char* sailingID  // in: sailing about to load
+);
+//loads every reservation of the sailing into an in-memory table keyed by plate
+//until releaseSailingCheckIn(): lookups on the sailing are served from it and
+//onboard changes are logged at once but written to the file in batches
+//preparing a prepared sailing reloads its table
+//returns the number of reservations loaded, -1 if storage is closed or the ID is malformed
+
+//-----------------------------------------------
+void releaseSailingCheckIn(
+    const char* sailingID  // in: sailing that departed
+);
+//writes the sailing's pending onboard changes to its file and drops its table
+//no-op if the sailing is not prepared
+
 //-----------------------------------------------
 std::optional<Reservation> getReservationByLicenseAndID(
     const char* reservationID
@@ -75,6 +178,14 @@ bool setOnboardStatus(
 //updates the onboard status for a given reservation ID
 //returns true if the update was successful
 
+//-----------------------------------------------
+bool setOnboardStatus(
+    const RecordHandle &handle,  // in: handle from a lookup
+    bool onboard                 // in: onboard status to set
+);
+//updates the onboard status of the record the handle names
+//returns false if the record was deleted or moved since the lookup
+
 //-----------------------------------------------
 bool getOnboardStatus(
     const std::string &reservationID  // in: ID of reservation
@@ -8,14 +8,13 @@
     Purpose: 
         This module implements the reservation command processing layer for the ferry 
         reservation system. It handles user interactions for creating, canceling, and 
-        checking in reservations. The module coordinates between the UI layer and the 
-        ASM layer, performing business logic validation including capacity checking, 
-        lane assignment based on vehicle dimensions, and fare calculations. It supports 
+        checking in reservations. Each workflow collects and validates input, then
+        sends one request through the ferry client (to the server, or in-process);
+        the request handlers apply the business rules - capacity checking, lane
+        assignment based on vehicle dimensions, and fare calculations. It supports 
         both registered vehicles (from vehicle database) and unregistered vehicles 
-        (ad-hoc entries). The module uses a two-tier lane system with different pricing 
-        algorithms based on vehicle size categories.
+        (ad-hoc entries).
         
-        Algorithm: Lane assignment uses height-first then length-based allocation
         Data validation: Input sanitization and range checking for all user inputs
 */
 
@@ -25,13 +24,15 @@
 #include <iostream>
 #include <limits>
 #include <string>
+#include <vector>
 #include "ReservationCommandProcessor.h"
-#include "ReservationASM.h"
-#include "SailingASM.h"
-#include "VehicleASM.h"
+#include "FerryClient.h"
+#include "ReservationASM.h"     // makeReservationID
+#include "ReservationService.h" // assignLane
 #include "MenuUI.h"
 #include "Reservation.h"
 #include "Sailing.h" 
+#include "Units.h"
 #include "Vehicle.h"
 
 using namespace std;
@@ -48,12 +49,39 @@ bool isValidSailingID(const char* id) {
     return true;
 }
 
+//-----------------------------------------------
+// helper: message for a failed create request
+static void printCreateError(FerryStatus status)
+{
+    switch (status)
+    {
+        case FerryStatus::VEHICLE_NOT_FOUND:
+            cout << "\033[31mError: License plate not in system\n\033[0m";
+            break;
+        case FerryStatus::SAILING_NOT_FOUND:
+            cout << "\033[31mError: Sailing ID does not exist\n\033[0m";
+            break;
+        case FerryStatus::ALREADY_EXISTS:
+            cout << "\033[31mError: A reservation already exists for this vehicle on this sailing.\n\033[0m";
+            break;
+        case FerryStatus::NO_CAPACITY:
+            cout << "\033[31mError: Remaining capacity is not enough for vehicle size\n\033[0m";
+            break;
+        case FerryStatus::STORAGE_FAILED:
+            cout << "\033[31mError: Reservation could not be created.\n\033[0m";
+            break;
+        default:
+            cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+            break;
+    }
+}
+
 //-----------------------------------------------
 void createReservationForRegisteredVehicle()
 {
-    Vehicle vehicleRecord;          // stores retrieved vehicle data from database
-    Reservation newReservation;     // reservation record to be created
-    Sailing sailingRecord;          // sailing data for capacity checking
+    Vehicle vehicleRecord;          // registered vehicle, for the existence check
+    ReservationCreateRequest request{};  // reservation to be created
+    ReservationCreateResponse result;    // lane the server assigned
     char sailingID[11];              // sailing identifier in format XXX-DD-HH
     char licensePlate[11];          // vehicle license plate number
 
@@ -61,16 +89,14 @@ void createReservationForRegisteredVehicle()
     cout << "\033[1;97mEnter License Plate Number (max 10 characters): \033[0m";
     cin >> licensePlate;
 
-    // Perform database lookup to retrieve existing vehicle information
-    auto existingVehicleOpt = getVehicleByLicensePlate(licensePlate);
-    if (!existingVehicleOpt)  // Vehicle not found in registered database
+    FerryStatus status = callFerry(FerryOp::VEHICLE_GET, makeKeyRequest(licensePlate), vehicleRecord);
+    if (status != FerryStatus::OK)  // Vehicle not found in registered database
     {
-        cout << "\033[31mError: License plate not in system\n\033[0m";
+        printCreateError(status == FerryStatus::NOT_FOUND ? FerryStatus::VEHICLE_NOT_FOUND : status);
         return;
     }
-    vehicleRecord = *existingVehicleOpt;  // Extract vehicle data from optional
 
-    // Step 2: Collect sailing information and validate sailing exists
+    // Step 2: Collect sailing information
     cout << "\033[1;97mEnter Sailing ID (format: XXX-DD-HH): \033[0m";
     cin >> sailingID;
 
@@ -80,112 +106,29 @@ void createReservationForRegisteredVehicle()
         return;  // Return to main menu on error
     }
 
-    // Step 3: Retrieve and validate sailing data for capacity checking
-    auto sailingOpt = getSailingByID(sailingID);
-    if (!sailingOpt)  // Invalid sailing ID provided
-    {
-        cout << "\033[31mError: Sailing ID does not exist\n\033[0m";
-        return;
-    }
-    sailingRecord = *sailingOpt;
-
-    // Step 4: Generate composite reservation ID using concatenation algorithm
-    char reservationID[21];
-    makeReservationID(licensePlate, sailingID, reservationID);
-
-    // Check for duplicate reservation to prevent double-booking
-    auto existingReservationOpt = getReservationByID(reservationID);
-    if (existingReservationOpt)  // Reservation already exists for this combination
-    {
-        cout << "\033[31mError: A reservation already exists for this vehicle on this sailing.\n\033[0m";
-        return;
-    }
-
-
-    // Step 5: Implement lane assignment algorithm based on vehicle dimensions
-    Lane assignedLane;
-    float vehicleWithBuffer = vehicleRecord.vehicleLength + 0.5;
-
-    if (vehicleRecord.vehicleHeight <= 2)  // Vehicle can use either lane
-    {
-        // Priority algorithm: try low lane first, then high lane
-        if (sailingRecord.LRL >= vehicleWithBuffer)  // Low lane has capacity
-        {
-            assignedLane = Lane::LOW;
-        } 
-        else if (sailingRecord.HRL >= vehicleWithBuffer)  // High lane has capacity
-        {
-            assignedLane = Lane::HIGH;
-        } 
-        else  // No lane has sufficient remaining capacity
-        {
-            cout << "\033[31mError: Remaining capacity is not enough for vehicle size\n\033[0m";
-            return;
-        }
-    } 
-    else  // Tall vehicle (>2m) must use high lane only
-    {
-        if (sailingRecord.HRL >= vehicleWithBuffer)  // High lane capacity check
-        {
-            assignedLane = Lane::HIGH;
-        } 
-        else  // High lane insufficient for tall vehicle
-        {
-            cout << "\033[31mError: Remaining capacity is not enough for vehicle size\n\033[0m";
-            return;
-        }
-    }
-
-    // Step 6: Construct reservation record with collected data
-    snprintf(newReservation.id, sizeof(newReservation.id), "%s", reservationID);
-    
-    // Zero out destination arrays before copying to ensure no garbage data
-    memset(newReservation.licensePlate, 0, sizeof(newReservation.licensePlate));
-    memset(newReservation.sailingID, 0, sizeof(newReservation.sailingID));
-    memset(newReservation.phone, 0, sizeof(newReservation.phone));
-    
-    strncpy(newReservation.licensePlate, licensePlate, sizeof(newReservation.licensePlate) - 1);
-    strncpy(newReservation.sailingID, sailingID, sizeof(newReservation.sailingID) - 1);
-    strncpy(newReservation.phone, vehicleRecord.phone, sizeof(newReservation.phone) - 1);
-    
-    newReservation.vehicleLength = vehicleRecord.vehicleLength;  // Copy from registered vehicle
-    newReservation.vehicleHeight = vehicleRecord.vehicleHeight;  // Copy from registered vehicle
-    newReservation.onboard = false;  // Initial onboard status
-
-    newReservation.expectedReturnDate = {0, 0, 0}; 
-    newReservation.reservedLane = assignedLane;  // Store calculated lane assignment
+    // Step 3: The handler checks the sailing, duplicates and lane capacity,
+    // and takes the vehicle's dimensions and phone from its vehicle record
+    copyKey(request.licensePlate, sizeof(request.licensePlate), licensePlate);
+    copyKey(request.sailingID, sizeof(request.sailingID), sailingID);
+    request.registered = 1;
 
-    // Attempt to persist reservation to storage
-    if (!addReservation(newReservation))  // Storage operation failed
+    status = callFerry(FerryOp::RESERVATION_CREATE, request, result);
+    if (status != FerryStatus::OK)
     {
-        cout << "\033[31mError: Reservation could not be created.\n\033[0m";
+        printCreateError(status);
         return;
     }
 
-    // Step 7: Update sailing capacity based on successful reservation
-    if (assignedLane == Lane::LOW)  // Update low lane remaining capacity
-    {
-        sailingRecord.LRL -= vehicleWithBuffer;
-    } 
-    else  // Update high lane remaining capacity
-    {
-        sailingRecord.HRL -= vehicleWithBuffer;
-    }
-
-    sailingRecord.reservationsCount++;  // Increment total reservation counter
-
-    // Persist updated sailing data with new capacity and count
-    updateSailing(sailingRecord);
-
     cout << "\033[32mReservation Created\n\033[0m";
 }
 
 //-----------------------------------------------
 void createReservationForUnregisteredVehicle()
 {
-    Vehicle tempVehicle;            // temporary vehicle record for unregistered vehicle
-    Reservation newReservation;     // reservation to be created
-    Sailing sailingRecord;          // sailing data for capacity validation
+    ReservationCreateRequest request{};  // reservation to be created
+    ReservationCreateResponse result;    // lane and vehicle-file outcome
+    SailingRow sailingRow;           // sailing data for the capacity pre-check
+    Reservation existing;            // duplicate check result
     char sailingID[11];              // sailing identifier
     char licensePlate[11];          // vehicle license plate
     char phoneNumber[13];           // contact phone number
@@ -201,13 +144,12 @@ void createReservationForUnregisteredVehicle()
     }
 
     // Retrieve sailing data to validate sailing exists and check capacity
-    auto sailingOpt = getSailingByID(sailingID);
-    if (!sailingOpt)  // Sailing ID not found in database
+    FerryStatus status = callFerry(FerryOp::SAILING_GET, makeKeyRequest(sailingID), sailingRow);
+    if (status != FerryStatus::OK)  // Sailing ID not found in database
     {
-        cout << "\033[31mError: Sailing ID does not exist\n\033[0m";
+        printCreateError(status == FerryStatus::NOT_FOUND ? FerryStatus::SAILING_NOT_FOUND : status);
         return;
     }
-    sailingRecord = sailingOpt.value();
 
     // Step 2: Collect vehicle identification
     cout << "\033[1;97mEnter License Plate Number (max 10 characters): \033[0m";
@@ -218,10 +160,10 @@ void createReservationForUnregisteredVehicle()
     makeReservationID(licensePlate, sailingID, reservationID);
 
     // Prevent double-booking by checking existing reservations
-    auto existingReservationOpt = getReservationByID(reservationID);
-    if (existingReservationOpt)  // Duplicate reservation found
+    status = callFerry(FerryOp::RESERVATION_GET, makeKeyRequest(reservationID), existing);
+    if (status != FerryStatus::NOT_FOUND)  // Duplicate reservation found (or no answer)
     {
-        cout << "\033[31mError: A reservation already exists for this vehicle on this sailing.\n\033[0m";
+        printCreateError(status == FerryStatus::OK ? FerryStatus::ALREADY_EXISTS : status);
         return;
     }
 
@@ -239,7 +181,7 @@ void createReservationForUnregisteredVehicle()
         std::cout << "\033[1;91mError: Vehicle length must be between 0.0 and 99.9\033[0m\n";
         return;  // go back to Main Menu
     }
-    tempVehicle.vehicleLength = static_cast<float>(length);
+    request.vehicleLength = toCentimetres(length);
 
     // Step 6: Collect vehicle height
     double height{};
@@ -255,92 +197,36 @@ void createReservationForUnregisteredVehicle()
         std::cout << "\033[1;91mError: Vehicle height must be between 0.0 and 9.9\033[0m\n";
         return;  // go back to Main Menu
     }
-    tempVehicle.vehicleHeight = static_cast<float>(height);
+    request.vehicleHeight = toCentimetres(height);
 
-    // Add 0.5-meter buffer for vehicle length
-    float vehicleWithBuffer = tempVehicle.vehicleLength + 0.5;
-
-    // Step 5: Apply lane assignment algorithm based on collected dimensions
+    // Step 5: Tell the clerk now if no lane has room, before asking for the phone
+    // (the handler assigns the lane again against the current capacity)
     Lane assignedLane;
-    if (tempVehicle.vehicleHeight <= 2)  // Standard height vehicle - can use either lane
-    {
-        // Priority-based assignment: prefer low lane, fallback to high lane
-        if (sailingRecord.LRL >= vehicleWithBuffer)  // Low lane available
-        {
-            assignedLane = Lane::LOW;
-        } 
-        else if (sailingRecord.HRL >= vehicleWithBuffer)  // High lane available
-        {
-            assignedLane = Lane::HIGH;
-        } 
-        else  // Neither lane has sufficient capacity
-        {
-            cout << "\033[31mError: Remaining capacity is not enough for vehicle size\n\033[0m";
-            return;
-        }
-    } 
-    else  // Overheight vehicle - high lane only
+    if (!ReservationService::assignLane(sailingRow.sailing, request.vehicleLength, request.vehicleHeight, assignedLane))
     {
-        if (sailingRecord.HRL >= vehicleWithBuffer)  // High lane capacity check
-        {
-            assignedLane = Lane::HIGH;
-        } 
-        else  // High lane insufficient for overheight vehicle
-        {
-            cout << "\033[31mError: Remaining capacity is not enough for vehicle size\n\033[0m";
-            return;
-        }
+        printCreateError(FerryStatus::NO_CAPACITY);
+        return;
     }
 
     // Step 6: Collect contact information for unregistered vehicle
     cout << "\033[1;97mEnter Phone Number (max 14 characters): \033[0m";
     cin >> phoneNumber;
 
-    // Step 7: Construct reservation record with collected data
-    snprintf(newReservation.id, sizeof(newReservation.id), "%s", reservationID);
-    strncpy(newReservation.licensePlate, licensePlate, sizeof(newReservation.licensePlate) - 1);
-    strncpy(newReservation.sailingID, sailingID, sizeof(newReservation.sailingID) - 1);
-    newReservation.vehicleLength = tempVehicle.vehicleLength;  // Use entered dimensions
-    newReservation.vehicleHeight = tempVehicle.vehicleHeight;  // Use entered dimensions
-    strncpy(newReservation.phone, phoneNumber, sizeof(newReservation.phone) - 1);
-    newReservation.onboard = false;  // Initial onboard status
-
-    newReservation.expectedReturnDate = {0, 0, 0}; 
-    newReservation.reservedLane = assignedLane;  // Calculated lane assignment
+    // Step 7: Create the reservation; the handler also adds the vehicle to
+    // the vehicle database for future use
+    copyKey(request.licensePlate, sizeof(request.licensePlate), licensePlate);
+    copyKey(request.sailingID, sizeof(request.sailingID), sailingID);
+    copyKey(request.phone, sizeof(request.phone), phoneNumber);
+    request.registered = 0;
 
-    // Attempt to store reservation in persistent storage
-    if (!addReservation(newReservation))  // Storage write failed
+    status = callFerry(FerryOp::RESERVATION_CREATE, request, result);
+    if (status != FerryStatus::OK)
     {
-        cout << "\033[31mError: Reservation could not be created.\n\033[0m";
+        printCreateError(status);
         return;
     }
 
-    // Step 8: Update sailing capacity after successful reservation creation
-    if (assignedLane == Lane::LOW)  // Deduct from low lane capacity
-    {
-        sailingRecord.LRL -= vehicleWithBuffer;
-    } 
-    else  // Deduct from high lane capacity
-    {
-        sailingRecord.HRL -= vehicleWithBuffer;
-    }
-
-    sailingRecord.reservationsCount++;  // Increment reservation counter
-
-    // Persist updated sailing data
-    updateSailing(sailingRecord);
-
-    // Step 10: Add vehicle to vehicle database for future use
-    // Populate tempVehicle with all collected information
-    memset(tempVehicle.licensePlate, 0, sizeof(tempVehicle.licensePlate));
-    memset(tempVehicle.phone, 0, sizeof(tempVehicle.phone));
-    
-    strncpy(tempVehicle.licensePlate, licensePlate, sizeof(tempVehicle.licensePlate) - 1);
-    strncpy(tempVehicle.phone, phoneNumber, sizeof(tempVehicle.phone) - 1);
-    // vehicleLength and vehicleHeight already set above
-
-    // Add vehicle to database (ignore failure - reservation is already created)
-    if (!addVehicle(tempVehicle))
+    if (!result.vehicleSaved)  // The reservation is created either way
     {
         cout << "\033[31mWarning: Vehicle could not be added to database,\033[32m but reservation was created successfully.\n\033[0m";
     }
@@ -386,6 +272,7 @@ void cancelReservation()
 {
     char licensePlate[11];          // license plate identifier
     char sailingID[11];             // sailing identifier (increased size)
+    ReservationKeyRequest request;  // reservation to cancel
 
     // Step 1: Collect reservation identification information
     cout << "\n\033[94m[\033[1;96mDELETE EXISTING RESERVATION\033[94m]\033[0m" << endl;
@@ -402,61 +289,33 @@ void cancelReservation()
     cout << "\033[1;97mEnter Sailing ID (format: XXX-DD-HH): \033[0m";
     cin >> sailingID;
 
-    // Step 3: Generate composite reservation ID for lookup
-    char reservationID[21];
-    makeReservationID(licensePlate, sailingID, reservationID);
+    // Step 3: Cancel; the handler refuses checked-in vehicles and gives the
+    // vehicle's space back to its lane in the same transaction
+    copyKey(request.licensePlate, sizeof(request.licensePlate), licensePlate);
+    copyKey(request.sailingID, sizeof(request.sailingID), sailingID);
 
-    // Retrieve reservation record using composite key
-    optional<Reservation> reservationOpt = getReservationByID(reservationID);
-    if (!reservationOpt)  // Reservation not found in database
+    FerryStatus status = callFerry(FerryOp::RESERVATION_CANCEL, request);
+    switch (status)
     {
-        cout << "\033[31mError: Reservation not found\n\033[0m";
-        return;
-    }
-    Reservation reservationRecord = *reservationOpt;
-
-    // Step 4: Business rule validation - prevent cancellation after check-in
-    if (reservationRecord.onboard)  // Vehicle already checked in
-    {
-        cout << "\033[31mError: Customer already checked in\n\033[0m";
-        return;
-    }
-
-    // Step 5: Retrieve sailing data for capacity restoration
-    optional<Sailing> sailingOpt = getSailingByID(sailingID);
-    if (!sailingOpt)  // Sailing data not found
-    {
-        cout << "\033[31mError: Sailing not found\n\033[0m";
-        return;
-    }
-    Sailing sailingRecord = *sailingOpt;
-
-    // Step 6: Restore sailing capacity by adding back canceled vehicle's space
-    const float buffer = 0.5f;  // 0.5 meter buffer
-        
-        if (reservationRecord.reservedLane == Lane::LOW)  // Add back to low lane
-        {
-            sailingRecord.LRL += (reservationRecord.vehicleLength + buffer);  // Add the vehicle length + buffer
-        } 
-        else  // Add back to high lane
-        {
-            sailingRecord.HRL += (reservationRecord.vehicleLength + buffer);  // Add the vehicle length + buffer
-        }
-
-    // Step 7: Remove reservation record from persistent storage
-    if (!deleteReservation(reservationRecord.licensePlate))  // Deletion operation failed
-    {
-        cout << "\033[31mError: Reservation could not be deleted.\n\033[0m";
-        return;
+        case FerryStatus::OK:
+            cout << "\033[32mCancelation Successful\033[0m\n";
+            break;
+        case FerryStatus::NOT_FOUND:  // Reservation not found in database
+            cout << "\033[31mError: Reservation not found\n\033[0m";
+            break;
+        case FerryStatus::ALREADY_ONBOARD:  // Vehicle already checked in
+            cout << "\033[31mError: Customer already checked in\n\033[0m";
+            break;
+        case FerryStatus::SAILING_NOT_FOUND:  // Sailing data not found
+            cout << "\033[31mError: Sailing not found\n\033[0m";
+            break;
+        case FerryStatus::STORAGE_FAILED:  // Deletion operation failed
+            cout << "\033[31mError: Reservation could not be deleted.\n\033[0m";
+            break;
+        default:
+            cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+            break;
     }
-
-    // Step 8: Update sailing statistics after successful cancellation
-    sailingRecord.reservationsCount--;  // Decrement reservation counter
-
-    // Step 9: Persist updated sailing data with restored capacity
-    updateSailing(sailingRecord);
-
-    cout << "\033[32mCancelation Successful\033[0m\n";
 }
 
 //-----------------------------------------------
@@ -464,6 +323,8 @@ void checkInReservation()
 {
     char licensePlate[11];          // vehicle license plate identifier
     char sailingID[11];              // sailing identifier
+    ReservationKeyRequest request;  // reservation to check in
+    CheckInResponse result;         // fare to collect
 
     while (true)  // Loop goal: process multiple check-ins until user exits
     {
@@ -488,52 +349,124 @@ void checkInReservation()
         cout << "\033[1;97mEnter Sailing ID (format: XXX-DD-HH): \033[0m";
         cin >> sailingID;
 
-        // Step 3: Generate reservation ID for database lookup
-        char reservationID[21];
-        makeReservationID(licensePlate, sailingID, reservationID);
+        // Step 3: Check in; the handler refuses double check-ins and prices
+        // the fare by vehicle size
+        copyKey(request.licensePlate, sizeof(request.licensePlate), licensePlate);
+        copyKey(request.sailingID, sizeof(request.sailingID), sailingID);
 
-        // Retrieve reservation using composite key (same method as cancelReservation)
-        optional<Reservation> reservationOpt = getReservationByID(reservationID);
-        if (!reservationOpt)  // Reservation not found
+        FerryStatus status = callFerry(FerryOp::RESERVATION_CHECK_IN, request, result);
+        switch (status)
         {
-            cout << "\033[31mError: Reservation not found\n\033[0m";
-            continue;  // Continue to next iteration for another vehicle
+            case FerryStatus::OK:
+                cout << "\033[32mCollect $" << result.fare << endl;
+                cout << "\033[32mCheck-in Successful\033[0m\n";
+                break;
+            case FerryStatus::NOT_FOUND:  // Reservation not found
+                cout << "\033[31mError: Reservation not found\n\033[0m";
+                break;
+            case FerryStatus::ALREADY_ONBOARD:  // Vehicle already checked in
+                cout << "\033[31mError: Customer already checked-in\n\033[0m";
+                break;
+            case FerryStatus::STORAGE_FAILED:  // Status update failed
+                cout << "\033[31mError: Failed to update onboard status\n\033[0m";
+                break;
+            default:
+                cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+                break;
         }
+    }
+}
 
-        Reservation reservationRecord = *reservationOpt;
+//-----------------------------------------------
+void batchCheckInReservations()
+{
+    const size_t PLATE_SIZE = sizeof(Reservation::licensePlate);
+    char sailingID[11];              // sailing being loaded
+    vector<string> plates;           // check-in queue, in arrival order
 
-        // Step 4: Validate check-in eligibility - prevent double check-in
-        if (reservationRecord.onboard)  // Vehicle already checked in
-        {
-            cout << "\033[31mError: Customer already checked-in\n\033[0m";
-            continue;  // Continue to next iteration
-        }
+    // Step 1: Collect the sailing and the queue of plates
+    cout << "\n\033[94m[\033[1;96mBATCH CHECK-IN\033[94m]" << endl;
+    cout << "\033[94m-------------------------------------------------------------------------------\033[0m" << endl;
+    cout << "\033[1;97mEnter Sailing ID (format: XXX-DD-HH): \033[0m";
+    cin >> sailingID;
+    if (!isValidSailingID(sailingID))
+    {
+        cout << "\033[31mError: Sailing ID not named correctly\n\033[0m";
+        return;
+    }
 
-        // Step 5: Calculate fare using tiered pricing algorithm based on vehicle size
-        double calculatedFare = 0;
-        if (reservationRecord.vehicleHeight <= 2)  // Standard height vehicle
-        {
-            calculatedFare = 14.0;  // Fixed rate for normal vehicles
-        } 
-        else if (reservationRecord.vehicleLength > 7 && reservationRecord.vehicleHeight <= 2)  // Long low vehicle
+    cout << "\033[1;97mEnter Vehicle Plate Numbers (max 10 characters), one per line, [0] to finish: \033[0m";
+    string plate;
+    while (cin >> plate && plate != "0")  // Loop goal: queue plates until the terminator
+    {
+        if (plate.size() > 10)
         {
-            calculatedFare = reservationRecord.vehicleLength * 2.0;  // $2 per meter pricing
-        } 
-        else if (reservationRecord.vehicleLength > 7 && reservationRecord.vehicleHeight > 2)  // Long overheight vehicle
+            cout << "\033[31mError: Plate " << plate << " is too long, skipped\n\033[0m";
+            continue;
+        }
+        if (plates.size() == FERRY_MAX_BATCH_PLATES)  // One request carries at most this many
         {
-            calculatedFare = reservationRecord.vehicleLength * 3.0;  // $3 per meter premium pricing
+            cout << "\033[31mError: Batch is full, plate " << plate << " skipped\n\033[0m";
+            continue;
         }
+        plates.push_back(plate);
+    }
+    if (plates.empty()) return;
+
+    // Step 2: One request for the whole queue; the handler resolves it with
+    // one batch lookup and commits every onboard update together
+    BatchCheckInHeader header{};
+    copyKey(header.sailingID, sizeof(header.sailingID), sailingID);
+    header.count = static_cast<uint32_t>(plates.size());
+
+    vector<char> request(sizeof(header) + plates.size() * PLATE_SIZE, 0);
+    memcpy(request.data(), &header, sizeof(header));
+    for (size_t i = 0; i < plates.size(); ++i)
+    {
+        copyKey(request.data() + sizeof(header) + i * PLATE_SIZE, PLATE_SIZE, plates[i].c_str());
+    }
+
+    vector<char> response;
+    FerryStatus status = callFerry(FerryOp::RESERVATION_CHECK_IN_BATCH, request.data(), request.size(), response);
+    if (status == FerryStatus::STORAGE_FAILED)
+    {
+        cout << "\033[31mError: Check-ins could not be saved.\n\033[0m";
+        return;
+    }
+    if (status != FerryStatus::OK || response.size() != plates.size() * sizeof(BatchCheckInResult))
+    {
+        cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+        return;
+    }
 
-        // Step 6: Display calculated fare to user
-        cout << "\033[32mCollect $" << calculatedFare << endl;
+    // Step 3: Report each vehicle in queue order
+    int checkedIn = 0;
+    double totalFare = 0;
+    for (size_t i = 0; i < plates.size(); ++i)
+    {
+        BatchCheckInResult result;
+        memcpy(&result, response.data() + i * sizeof(result), sizeof(result));
 
-        // Step 7: Update reservation status to indicate successful check-in
-        if (!setOnboardStatus(reservationID, true))  // Status update failed
+        cout << "\033[1;97m" << plates[i] << ": \033[0m";
+        switch (static_cast<FerryStatus>(result.status))
         {
-            cout << "\033[31mError: Failed to update onboard status\n\033[0m";
-            continue;  // Continue to next iteration
+            case FerryStatus::OK:
+                cout << "\033[32mCollect $" << result.fare << "\033[0m\n";
+                totalFare += result.fare;
+                ++checkedIn;
+                break;
+            case FerryStatus::NOT_FOUND:
+                cout << "\033[31mError: Reservation not found\n\033[0m";
+                break;
+            case FerryStatus::ALREADY_ONBOARD:
+                cout << "\033[31mError: Customer already checked-in\n\033[0m";
+                break;
+            default:
+                cout << "\033[31mError: Failed to update onboard status\n\033[0m";
+                break;
         }
-
-        cout << "\033[32mCheck-in Successful\033[0m\n";
     }
-}
\ No newline at end of file
+
+    cout << "\033[32mChecked in " << checkedIn << " of " << plates.size()
+         << " vehicles, $" << totalFare << " collected\033[0m\n";
+}
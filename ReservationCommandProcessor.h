@@ -42,4 +42,11 @@ void checkInReservation();
 // out: none
 // Purpose: Prompt for reservation ID, compute fee, and update onboard status.
 
+//-----------------------------------------------
+void batchCheckInReservations();
+// in:  none
+// out: none
+// Purpose: Prompt for a sailing ID and a queue of plates, resolve them with
+//          one batch lookup, then check in every eligible vehicle.
+
 #endif // RESERVATION_COMMAND_PROCESSOR_H
\ No newline at end of file
@@ -0,0 +1,64 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: ReservationKey.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Conversions between reservation IDs, plate + sailing ID pairs and
+        ReservationKey.
+*/
+
+//============================================
+
+#include <cstring>
+#include "RecordFormat.h"
+#include "ReservationKey.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr size_t RESERVATION_ID_LENGTH = 20;  // plate + sailing ID, '*'-padded
+static constexpr size_t SAILING_ID_LENGTH = 9;       // XXX-DD-HH
+static constexpr size_t PLATE_MAX_LENGTH = 10;
+
+//-----------------------------------------------
+bool makeReservationKey(const char *licensePlate, const char *sailingID, ReservationKey &key)
+{
+    key = ReservationKey{};
+    ReservationKey made;
+    if (!encodePlate(licensePlate, made.plate) || !encodeSailingID(sailingID, made.sailing)) return false;
+    key = made;
+    return true;
+}
+
+//-----------------------------------------------
+bool parseReservationID(const char *reservationID, ReservationKey &key)
+{
+    key = ReservationKey{};
+    size_t length = strnlen(reservationID, RESERVATION_ID_LENGTH + 1);
+    if (length > RESERVATION_ID_LENGTH) return false;
+    while (length > 0 && reservationID[length - 1] == '*') --length;  // Strip the padding
+    if (length <= SAILING_ID_LENGTH || length > PLATE_MAX_LENGTH + SAILING_ID_LENGTH) return false;
+
+    char plate[PLATE_MAX_LENGTH + 1] = {};
+    char sailingID[SAILING_ID_LENGTH + 1] = {};
+    memcpy(plate, reservationID, length - SAILING_ID_LENGTH);
+    memcpy(sailingID, reservationID + length - SAILING_ID_LENGTH, SAILING_ID_LENGTH);
+    return makeReservationKey(plate, sailingID, key);
+}
+
+//-----------------------------------------------
+void formatReservationID(const ReservationKey &key, char outID[21])
+{
+    char plate[PLATE_MAX_LENGTH + 1];
+    char sailingID[SAILING_ID_LENGTH + 1];
+    decodePlate(key.plate, plate);
+    decodeSailingID(key.sailing, sailingID);
+
+    size_t plateLength = strlen(plate);
+    memcpy(outID, plate, plateLength);
+    memcpy(outID + plateLength, sailingID, SAILING_ID_LENGTH);
+    for (size_t i = plateLength + SAILING_ID_LENGTH; i < RESERVATION_ID_LENGTH; ++i) outID[i] = '*';
+    outID[RESERVATION_ID_LENGTH] = '\0';
+}
@@ -0,0 +1,73 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: ReservationKey.h
+/*
+    Module: ReservationKey.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Integer form of a reservation's identity (license plate + sailing
+        ID). The plate is packed 6 bits per character and the sailing ID is
+        its encodeSailingID code, so hashing, comparing and ordering keys
+        are a few integer operations. The 20-character reservation ID
+        (plate + sailing ID, '*'-padded) stays the display and log form;
+        both forms of the same reservation give the same key.
+*/
+
+#ifndef RESERVATION_KEY_H
+#define RESERVATION_KEY_H
+
+#include <cstdint>
+
+//-----------------------------------------------
+// Struct:  ReservationKey
+// Purpose: Packed plate and sailing code. sailing == 0 marks "no key"
+//          (an ID or plate that cannot belong to a stored reservation).
+//          Keys order by plate, then by sailing code.
+struct ReservationKey
+{
+    std::uint64_t plate = 0;    // encodePlate code
+    std::uint32_t sailing = 0;  // encodeSailingID code
+
+    bool isValid() const { return sailing != 0; }
+
+    std::uint64_t hash() const
+    {
+        // splitmix64 finalizer over both words
+        std::uint64_t h = plate ^ (static_cast<std::uint64_t>(sailing) * 0x9E3779B97F4A7C15ull);
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+        return h ^ (h >> 31);
+    }
+
+    bool operator==(const ReservationKey &other) const { return plate == other.plate && sailing == other.sailing; }
+    bool operator!=(const ReservationKey &other) const { return !(*this == other); }
+    bool operator<(const ReservationKey &other) const
+    {
+        return plate != other.plate ? plate < other.plate : sailing < other.sailing;
+    }
+};
+
+//-----------------------------------------------
+bool makeReservationKey(
+    const char *licensePlate,  // in: plate (1-10 characters)
+    const char *sailingID,     // in: sailing ID (XXX-DD-HH)
+    ReservationKey &key        // out: key; invalid on false
+);
+// out: false if the plate or the sailing ID has no packed form
+
+//-----------------------------------------------
+bool parseReservationID(
+    const char *reservationID,  // in: plate + sailing ID, '*'-padded or not
+    ReservationKey &key         // out: key; invalid on false
+);
+// out: false if the ID is not a plate followed by a sailing ID
+// The sailing ID is the last 9 characters once the padding is stripped.
+
+//-----------------------------------------------
+void formatReservationID(
+    const ReservationKey &key,  // in: valid key
+    char outID[21]              // out: plate + sailing ID, '*'-padded to 20
+);
+// Same text as makeReservationID for the key's plate and sailing.
+
+#endif // RESERVATION_KEY_H
@@ -0,0 +1,372 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: ReservationService.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the reservation service. Every check a menu makes
+        is repeated here against current data, because a front end's view
+        may be stale by the time its request runs. Multi-record changes run
+        as one write-ahead log transaction, so a request is applied
+        completely or not at all.
+
+        Algorithm: lane assignment is height first (over 2 m: high lane
+        only), then low lane before high lane; every vehicle occupies its
+        length plus a 0.5 m buffer. All lengths are whole centimetres, so
+        capacity comparisons and sums are exact integer math. A booking takes that space from the
+        sailing's capacity word by compare-and-swap (reserveLaneSpace), so
+        bookings on one sailing run in parallel and never oversell it.
+
+        Concurrency: a booking holds its sailing's stripe shared (deleting
+        the sailing takes it exclusively) and its reservation key's stripe,
+        so the same vehicle cannot be booked, cancelled or checked in twice
+        at once. Requests are turned into a ReservationKey once; lookups and
+        stripes work on the key, not on the 20-character ID.
+
+        Check-in rush: preparing a sailing has ReservationASM hold its
+        reservations in memory until the sailing departs, so checkIn and
+        checkInBatch run unchanged but are served from the table.
+*/
+
+//============================================
+
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_set>
+#include "ReservationService.h"
+#include "ReservationASM.h"
+#include "RecordFormat.h"
+#include "ReservationKey.h"
+#include "SailingASM.h"
+#include "SailingService.h"
+#include "Units.h"
+#include "VehicleASM.h"
+#include "WriteAheadLog.h"
+
+using namespace std;
+
+//============================================
+
+static const int32_t LANE_BUFFER = 50;             // centimetres kept free behind each vehicle
+static const int32_t LOW_LANE_MAX_HEIGHT = 200;    // centimetres; taller vehicles take the high lane
+static const int32_t LONG_VEHICLE_LENGTH = 700;    // centimetres; longer vehicles pay by the metre
+static const int32_t MAX_VEHICLE_LENGTH = 9990;    // centimetres (99.9 m)
+static const int32_t MAX_VEHICLE_HEIGHT = 990;     // centimetres (9.9 m)
+static const size_t RESERVATION_LOCK_STRIPES = 64;
+
+static mutex reservationLocks[RESERVATION_LOCK_STRIPES];  // one booking per reservation key at a time
+
+//-----------------------------------------------
+// helper: lock stripe of a reservation key
+static size_t reservationStripe(const ReservationKey &key)
+{
+    return key.hash() % RESERVATION_LOCK_STRIPES;
+}
+
+//-----------------------------------------------
+// helper: hold a reservation key against concurrent create, cancel and check-in
+static unique_lock<mutex> lockReservation(const ReservationKey &key)
+{
+    return unique_lock<mutex>(reservationLocks[reservationStripe(key)]);
+}
+
+//-----------------------------------------------
+// helper: hold every stripe a batch touches, in stripe order so two
+// batches cannot deadlock
+static vector<unique_lock<mutex>> lockReservations(const vector<ReservationKey> &keys)
+{
+    vector<bool> needed(RESERVATION_LOCK_STRIPES, false);
+    for (const ReservationKey &key : keys) needed[reservationStripe(key)] = true;
+
+    vector<unique_lock<mutex>> locks;
+    for (size_t stripe = 0; stripe < RESERVATION_LOCK_STRIPES; ++stripe)
+    {
+        if (needed[stripe]) locks.emplace_back(reservationLocks[stripe]);
+    }
+    return locks;
+}
+
+//-----------------------------------------------
+// helper: run a handle-based update, looking the record up again once if
+// its sailing's file was compacted since the lookup (the handle then no
+// longer matches). The caller's key lock keeps the record itself in place.
+template <typename Update>
+static bool updateByHandle(const ReservationKey &key, RecordHandle &handle, Update update)
+{
+    if (update(handle)) return true;
+    return getReservationByKey(key, handle) && update(handle);
+}
+
+//-----------------------------------------------
+bool ReservationService::assignLane(const Sailing &sailing, int32_t vehicleLength, int32_t vehicleHeight, Lane &lane)
+{
+    int32_t vehicleWithBuffer = vehicleLength + LANE_BUFFER;
+
+    if (vehicleHeight <= LOW_LANE_MAX_HEIGHT)  // Vehicle can use either lane, low lane first
+    {
+        if (sailing.LRL >= vehicleWithBuffer)
+        {
+            lane = Lane::LOW;
+            return true;
+        }
+        if (sailing.HRL >= vehicleWithBuffer)
+        {
+            lane = Lane::HIGH;
+            return true;
+        }
+        return false;
+    }
+
+    // Tall vehicle (>2m) must use high lane only
+    if (sailing.HRL >= vehicleWithBuffer)
+    {
+        lane = Lane::HIGH;
+        return true;
+    }
+    return false;
+}
+
+//-----------------------------------------------
+double ReservationService::checkInFare(const Reservation &reservationRecord)
+{
+    double calculatedFare = 0;
+    int32_t length = reservationRecord.vehicleLength;
+    int32_t height = reservationRecord.vehicleHeight;
+    if (height <= LOW_LANE_MAX_HEIGHT)  // Standard height vehicle
+    {
+        calculatedFare = 14.0;  // Fixed rate for normal vehicles
+    }
+    else if (length > LONG_VEHICLE_LENGTH && height <= LOW_LANE_MAX_HEIGHT)  // Long low vehicle
+    {
+        calculatedFare = toMetres(length) * 2.0;  // $2 per meter pricing
+    }
+    else if (length > LONG_VEHICLE_LENGTH && height > LOW_LANE_MAX_HEIGHT)  // Long overheight vehicle
+    {
+        calculatedFare = toMetres(length) * 3.0;  // $3 per meter premium pricing
+    }
+    return calculatedFare;
+}
+
+//-----------------------------------------------
+FerryStatus ReservationService::create(const ReservationCreateRequest &request, ReservationCreateResponse &result)
+{
+    // Step 1: Vehicle dimensions and contact, from the vehicle file or the request
+    Reservation newReservation{};
+    copyKey(newReservation.licensePlate, sizeof(newReservation.licensePlate), request.licensePlate);
+    copyKey(newReservation.sailingID, sizeof(newReservation.sailingID), request.sailingID);
+    if (request.registered)
+    {
+        optional<Vehicle> vehicleOpt = getVehicleByLicensePlate(request.licensePlate);
+        if (!vehicleOpt) return FerryStatus::VEHICLE_NOT_FOUND;
+        newReservation.vehicleLength = vehicleOpt->vehicleLength;
+        newReservation.vehicleHeight = vehicleOpt->vehicleHeight;
+        copyKey(newReservation.phone, sizeof(newReservation.phone), vehicleOpt->phone);
+    }
+    else
+    {
+        if (request.vehicleLength < 0 || request.vehicleLength > MAX_VEHICLE_LENGTH ||
+            request.vehicleHeight < 0 || request.vehicleHeight > MAX_VEHICLE_HEIGHT)
+        {
+            return FerryStatus::BAD_REQUEST;
+        }
+        newReservation.vehicleLength = request.vehicleLength;
+        newReservation.vehicleHeight = request.vehicleHeight;
+        copyKey(newReservation.phone, sizeof(newReservation.phone), request.phone);
+    }
+
+    // Step 2: Sailing and duplicate check; the sailing cannot be deleted
+    // and the reservation cannot be booked twice until the commit. A plate
+    // outside the key alphabet cannot be stored; a sailing ID outside it
+    // names no sailing.
+    ReservationKey key;
+    if (!makeReservationKey(request.licensePlate, request.sailingID, key))
+    {
+        uint64_t plateCode;
+        return encodePlate(request.licensePlate, plateCode) ? FerryStatus::SAILING_NOT_FOUND : FerryStatus::BAD_REQUEST;
+    }
+    formatReservationID(key, newReservation.id);
+    shared_lock<shared_mutex> sailingLock = SailingService::shareSailing(request.sailingID);
+    unique_lock<mutex> reservationLock = lockReservation(key);
+    if (!getSailingByID(request.sailingID)) return FerryStatus::SAILING_NOT_FOUND;
+    RecordHandle existing;
+    if (getReservationByKey(key, existing)) return FerryStatus::ALREADY_EXISTS;
+
+    // Step 3: Take the space (compare-and-swap, low lane first for vehicles
+    // up to 2 m) and store the reservation; both commit together
+    int32_t space = newReservation.vehicleLength + LANE_BUFFER;
+    Lane assignedLane;
+    beginTransaction();
+    if (!reserveLaneSpace(request.sailingID, space, newReservation.vehicleHeight > LOW_LANE_MAX_HEIGHT, assignedLane))
+    {
+        abortTransaction();
+        return FerryStatus::NO_CAPACITY;
+    }
+    newReservation.onboard = false;
+    newReservation.expectedReturnDate = {0, 0, 0};
+    newReservation.reservedLane = assignedLane;
+    addReservation(newReservation);
+    if (!commitTransaction())
+    {
+        releaseLaneSpace(request.sailingID, assignedLane, space);  // The space was taken before the commit
+        return FerryStatus::STORAGE_FAILED;
+    }
+    reservationLock.unlock();
+    sailingLock.unlock();
+
+    // Step 4: Remember an unregistered vehicle for its next reservation
+    result = ReservationCreateResponse{assignedLane, 1};
+    if (!request.registered)
+    {
+        Vehicle newVehicle{};
+        copyKey(newVehicle.licensePlate, sizeof(newVehicle.licensePlate), request.licensePlate);
+        copyKey(newVehicle.phone, sizeof(newVehicle.phone), request.phone);
+        newVehicle.vehicleLength = newReservation.vehicleLength;
+        newVehicle.vehicleHeight = newReservation.vehicleHeight;
+        result.vehicleSaved = addVehicle(newVehicle) ? 1 : 0;  // The reservation stands either way
+    }
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus ReservationService::cancel(const ReservationKeyRequest &request)
+{
+    ReservationKey key;
+    if (!makeReservationKey(request.licensePlate, request.sailingID, key)) return FerryStatus::NOT_FOUND;
+
+    shared_lock<shared_mutex> sailingLock = SailingService::shareSailing(request.sailingID);
+    unique_lock<mutex> reservationLock = lockReservation(key);
+    RecordHandle reservationHandle;
+    optional<Reservation> reservationOpt = getReservationByKey(key, reservationHandle);
+    if (!reservationOpt) return FerryStatus::NOT_FOUND;
+    if (reservationOpt->onboard) return FerryStatus::ALREADY_ONBOARD;  // No cancellation after check-in
+    if (!getSailingByID(request.sailingID)) return FerryStatus::SAILING_NOT_FOUND;
+
+    // Delete the reservation, then give its space back to its lane. The
+    // space is released only once the delete is committed: released any
+    // earlier, another booking could take it before a failed commit had
+    // to take it back.
+    int32_t space = reservationOpt->vehicleLength + LANE_BUFFER;
+    Lane lane = reservationOpt->reservedLane;
+    beginTransaction();
+    bool deleted = updateByHandle(key, reservationHandle, [](const RecordHandle &h) { return deleteReservation(h); });
+    if (!deleted || !commitTransaction())
+    {
+        abortTransaction();
+        return FerryStatus::STORAGE_FAILED;
+    }
+    if (!releaseLaneSpace(request.sailingID, lane, space)) return FerryStatus::STORAGE_FAILED;
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus ReservationService::checkIn(const ReservationKeyRequest &request, CheckInResponse &result)
+{
+    ReservationKey key;
+    if (!makeReservationKey(request.licensePlate, request.sailingID, key)) return FerryStatus::NOT_FOUND;
+
+    shared_lock<shared_mutex> sailingLock = SailingService::shareSailing(request.sailingID);
+    unique_lock<mutex> reservationLock = lockReservation(key);
+    RecordHandle reservationHandle;
+    optional<Reservation> reservationOpt = getReservationByKey(key, reservationHandle);
+    if (!reservationOpt) return FerryStatus::NOT_FOUND;
+    if (reservationOpt->onboard) return FerryStatus::ALREADY_ONBOARD;
+
+    auto board = [](const RecordHandle &h) { return setOnboardStatus(h, true); };
+    if (!updateByHandle(key, reservationHandle, board)) return FerryStatus::STORAGE_FAILED;
+
+    result.fare = checkInFare(*reservationOpt);
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus ReservationService::checkInBatch(const char *sailingID, const char *const *plates, size_t count,
+                                             vector<BatchCheckInResult> &results)
+{
+    // Resolve the whole queue in one batch lookup; a plate without a key
+    // stays an invalid key and is simply not found
+    vector<ReservationKey> keys(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        makeReservationKey(plates[i], sailingID, keys[i]);
+    }
+    shared_lock<shared_mutex> sailingLock = SailingService::shareSailing(sailingID);
+    vector<unique_lock<mutex>> reservationLocks = lockReservations(keys);
+    vector<RecordHandle> handles;
+    vector<optional<Reservation>> found = getReservationsByKeys(keys.data(), keys.size(), &handles);
+
+    // Check in every eligible vehicle; the onboard updates commit together.
+    // A plate queued twice is already onboard the second time.
+    results.assign(count, BatchCheckInResult{0, 0.0});
+    unordered_set<uint64_t> boardedPlates;
+    auto board = [](const RecordHandle &h) { return setOnboardStatus(h, true); };
+    beginTransaction();
+    for (size_t i = 0; i < count; ++i)
+    {
+        FerryStatus status = FerryStatus::OK;
+        if (!found[i])
+        {
+            status = FerryStatus::NOT_FOUND;
+        }
+        else if (found[i]->onboard || boardedPlates.count(keys[i].plate) > 0)
+        {
+            status = FerryStatus::ALREADY_ONBOARD;
+        }
+        else if (!updateByHandle(keys[i], handles[i], board))
+        {
+            status = FerryStatus::STORAGE_FAILED;
+        }
+        else
+        {
+            boardedPlates.insert(keys[i].plate);
+            results[i].fare = checkInFare(*found[i]);
+        }
+        results[i].status = static_cast<uint16_t>(status);
+    }
+    if (!commitTransaction())
+    {
+        results.clear();
+        return FerryStatus::STORAGE_FAILED;
+    }
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus ReservationService::prepareSailing(const char *sailingID, PrepareSailingResponse &result)
+{
+    shared_lock<shared_mutex> sailingLock = SailingService::shareSailing(sailingID);  // Not deleted meanwhile
+    if (!getSailingByID(sailingID)) return FerryStatus::NOT_FOUND;
+
+    int loaded = prepareSailingCheckIn(sailingID);
+    if (loaded < 0) return FerryStatus::STORAGE_FAILED;
+    result.reservations = static_cast<uint32_t>(loaded);
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus ReservationService::departSailing(const char *sailingID)
+{
+    shared_lock<shared_mutex> sailingLock = SailingService::shareSailing(sailingID);
+    if (!getSailingByID(sailingID)) return FerryStatus::NOT_FOUND;
+
+    releaseSailingCheckIn(sailingID);
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus ReservationService::getReservation(const char *reservationID, Reservation &reservation)
+{
+    optional<Reservation> reservationOpt = getReservationByID(reservationID);
+    if (!reservationOpt) return FerryStatus::NOT_FOUND;
+    reservation = *reservationOpt;
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus ReservationService::getVehicle(const char *licensePlate, Vehicle &vehicle)
+{
+    optional<Vehicle> vehicleOpt = getVehicleByLicensePlate(licensePlate);
+    if (!vehicleOpt) return FerryStatus::NOT_FOUND;
+    vehicle = *vehicleOpt;
+    return FerryStatus::OK;
+}
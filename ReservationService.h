@@ -0,0 +1,110 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: ReservationService.h
+/*
+    Module: ReservationService.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the reservation service: the business rules for
+        booking, cancelling and checking in vehicles (lane assignment,
+        capacity bookkeeping, fares), as plain functions over request
+        structs. No terminal or socket I/O; the request handlers, the
+        benchmark and any other front end call it directly.
+
+        Text fields of the request structs must be null-terminated.
+        Calls are safe from any number of threads: lane space is taken
+        with compare-and-swap, so bookings on different sailings never
+        contend and bookings on one sailing never oversell it; only requests
+        for the same reservation wait for each other. Lookups take no lock.
+*/
+
+#ifndef RESERVATION_SERVICE_H
+#define RESERVATION_SERVICE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "FerryProtocol.h"
+
+namespace ReservationService
+{
+    //-----------------------------------------------
+    FerryStatus create(
+        const ReservationCreateRequest &request,  // in: vehicle, sailing and (new vehicles) dimensions
+        ReservationCreateResponse &result         // out: assigned lane, vehicle-file outcome
+    );
+    // Books the vehicle on the sailing: takes its space from the first lane
+    // with room and stores the reservation in one transaction.
+    // A new (unregistered) vehicle is then added to the vehicle file.
+
+    //-----------------------------------------------
+    FerryStatus cancel(
+        const ReservationKeyRequest &request  // in: plate and sailing
+    );
+    // Deletes a reservation that is not checked in, then gives its space
+    // back to its lane once the delete has committed.
+
+    //-----------------------------------------------
+    FerryStatus checkIn(
+        const ReservationKeyRequest &request,  // in: plate and sailing
+        CheckInResponse &result                // out: fare to collect
+    );
+    // Marks the reservation onboard and prices the fare.
+
+    //-----------------------------------------------
+    FerryStatus checkInBatch(
+        const char *sailingID,                     // in: sailing being loaded
+        const char *const *plates,                 // in: plates in arrival order
+        std::size_t count,                         // in: number of plates
+        std::vector<BatchCheckInResult> &results   // out: one status and fare per plate
+    );
+    // Resolves every plate with one batch lookup and checks in the
+    // eligible ones; the onboard updates commit together. A plate listed
+    // twice is ALREADY_ONBOARD the second time.
+
+    //-----------------------------------------------
+    FerryStatus prepareSailing(
+        const char *sailingID,            // in: sailing about to load
+        PrepareSailingResponse &result    // out: reservations loaded
+    );
+    // Warms the check-in path for a sailing: its reservations are held in
+    // memory, keyed by plate, so check-ins look them up without touching
+    // the files and their onboard flags are written back in batches.
+
+    //-----------------------------------------------
+    FerryStatus departSailing(
+        const char *sailingID  // in: sailing that has left
+    );
+    // Writes back the sailing's check-ins and drops its warm-up table.
+    // OK whether or not the sailing was prepared.
+
+    //-----------------------------------------------
+    FerryStatus getReservation(
+        const char *reservationID,  // in: plate + sailing ID
+        Reservation &reservation    // out: the reservation
+    );
+
+    //-----------------------------------------------
+    FerryStatus getVehicle(
+        const char *licensePlate,   // in: plate
+        Vehicle &vehicle            // out: the registered vehicle
+    );
+
+    //-----------------------------------------------
+    bool assignLane(
+        const Sailing &sailing,      // in: sailing with its remaining lane lengths
+        std::int32_t vehicleLength,  // in: centimetres, without the 0.5 m buffer
+        std::int32_t vehicleHeight,  // in: centimetres
+        Lane &lane                   // out: lane the vehicle fits in
+    );
+    // Vehicles up to 2 m high take the low lane first, then the high lane;
+    // taller vehicles only fit the high lane. Returns false if neither fits.
+
+    //-----------------------------------------------
+    double checkInFare(
+        const Reservation &reservation  // in: reservation being checked in
+    );
+    // Fare collected at check-in, tiered by vehicle size.
+}
+
+#endif // RESERVATION_SERVICE_H
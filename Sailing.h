@@ -13,11 +13,13 @@
 #ifndef SAILING_H
 #define SAILING_H
 
+#include <cstdint>
+
 struct Sailing {
     char id[10];           /// SailingID (primary key)
     char vesselName[26];  /// Foreign key to Vessel.vesselName
-    float LRL;            /// Low Remaining Length (In meters)
-    float HRL;            /// High Remaining Length (In meters)
+    std::int32_t LRL;     /// Low Remaining Length (In centimetres)
+    std::int32_t HRL;     /// High Remaining Length (In centimetres)
     int reservationsCount; // Track the number of reservations
 };
 
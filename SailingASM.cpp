@@ -11,137 +11,622 @@
         deletion, lookup, capacity calculations, and paginated reporting.
         
         Algorithm:
-            - File I/O using binary reads/writes of fixed-size Sailing structs
-            - Deletion: swap-last-record into target position then truncate file
-            - Reporting: fixed-width pagination of 5 entries per page
+            - Memory-mapped array of fixed-size Sailing structs (RecordStore)
+            - In-memory sailing table loaded once at startup and keyed by ID;
+              every read is served from it
+            - Write-back: updates mark the entry dirty and reach sailings.dat
+              in one batch at each log checkpoint and at shutdown (the
+              write-ahead log covers a crash in between); adds and deletes
+              are rare and write through
+            - Deletion: O(1) tombstone; sailings are only ever appended, so the
+              file (and the report) keeps insertion order
+            - Compaction: background task drops tombstones once they pass the
+              garbage threshold, preserving order
+            - Handles: lookups can return a RecordHandle (slot + generation)
+              so the follow-up update or delete skips the ID lookup
+            - Reporting: fixed-width pagination of 5 entries per page; each
+              row reads per-sailing aggregates (vehicle count, lane usage)
+              that ReservationASM adjusts on every create, cancel and delete,
+              and the vessel capacity is cached per vessel name
+            - Concurrency: one reader-writer lock over the table, the store
+              and the aggregates; lookups and report reads share it,
+              applied changes and compaction take it exclusively
+            - Capacity: each sailing's remaining lane lengths (fixed-point
+              centimetres), reservation count and a 12-bit version are
+              packed into one atomic word. Bookings take and return space
+              with compare-and-swap under the shared lock, so bookings
+              never wait on each other and a lane is never oversold. Every
+              change logs the new word; the table keeps the newest logged
+              version, so commits of one sailing may apply in any order
         Data validation:
             - File open/create success checks
-            - ID matching via `strncmp`
+            - ID lookup by direct addressing: a well-formed XXX-DD-HH ID is
+              encoded to an integer that indexes a two-level table
+              (terminal dictionary -> 744-entry day/hour block); other IDs
+              fall back to a small hash map
             - Goodbit checks on I/O operations
 */
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
-#include <fstream>
-#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
-#include <chrono>
-#include <ctime>
-#include <iomanip>
 #include "SailingASM.h"
 #include "Sailing.h"
 #include "ReservationASM.h"
 #include "VesselASM.h"
+#include "BackgroundTasks.h"
+#include "RecordFormat.h"
+#include "RecordStore.h"
+#include "WriteAheadLog.h"
 #include <cstring>
 using namespace std;
 
-static fstream sailingFile;  // Module-scope file handle for sailing storage access
+static RecordStore<Sailing, SailingCodec> sailingStore;  // Module-scope memory-mapped sailings.dat (packed records)
+static shared_mutex sailingMutex;  // Shared for lookups, exclusive for changes and the background compaction task
+static const char* SAILING_FILE = "sailings.dat";
+
+// In-memory sailing table; sailingTable mirrors sailingStore slot for slot
+// (tombstones included) and may run ahead of it for dirty slots
+static vector<Sailing> sailingTable;
+static vector<uint32_t> dirtySlots;                   // slots updated since the last write-back
+static vector<bool> slotDirty;                        // slotDirty[slot] == slot is in dirtySlots
+static size_t liveSailings = 0;                       // non-tombstone entries in sailingTable
+
+// Direct-addressed ID -> slot table. The block for a terminal is found in
+// terminalCodes (a handful of entries, searched linearly); within the block
+// an entry is (day-1)*24 + hour and holds slot + 1, 0 meaning no sailing.
+static constexpr uint32_t SAILING_SLOTS_PER_TERMINAL = 31 * 24;
+static vector<uint32_t> terminalCodes;                // block number -> packed terminal
+static vector<uint32_t> directSlots;                  // block * 744 + day/hour -> slot + 1
+
+// Report aggregates, keyed by sailing ID rather than slot so they survive
+// table reloads and may run ahead of the sailing record during log replay
+static unordered_map<string, SailingAggregate> sailingAggregates;
+static unordered_map<string, int32_t> vesselCapacities;  // vessel name -> lowCap + highCap in cm (vessels never change)
+
+// Capacity word: LRL (19 bits) | HRL (19 bits) | reservations (14 bits) | version (12 bits),
+// lane lengths in centimetres as stored in the Sailing record
+static constexpr int CAPACITY_LANE_BITS = 19;
+static constexpr int CAPACITY_COUNT_BITS = 14;
+static constexpr int CAPACITY_VERSION_BITS = 12;
+static constexpr uint64_t CAPACITY_LANE_MAX = (1u << CAPACITY_LANE_BITS) - 1;
+static constexpr uint64_t CAPACITY_COUNT_MAX = (1u << CAPACITY_COUNT_BITS) - 1;
+static constexpr uint32_t CAPACITY_VERSION_MASK = (1u << CAPACITY_VERSION_BITS) - 1;
+
+// Live capacity of one sailing. Keyed by ID, so the counters (and their
+// addresses) survive table reloads; slotCapacity points into this map.
+struct SailingCapacity
+{
+    atomic<uint64_t> live{0};      // taken and returned by compare-and-swap
+    uint32_t loggedVersion = 0;    // version of the capacity in sailingTable
+    bool versionKnown = false;     // false until a logged word reaches the table
+    uint32_t copies = 0;           // live slots holding the ID (an ID can be stored twice)
+};
+static unordered_map<string, SailingCapacity> sailingCapacities;
+static vector<SailingCapacity*> slotCapacity;         // slot -> its sailing's counter (nullptr for tombstones)
+
+// Logged capacity change (WAL SAILING_CAPACITY)
+struct SailingCapacityRecord
+{
+    char id[sizeof(Sailing::id)];
+    uint64_t capacity;             // packed capacity word after the change
+};
+
+//------------------------------------------------------------------------
+static string sailingKey(const char *id)
+// Table key for an ID: the characters up to its null, at most the field width.
+{
+    return string(id, strnlen(id, sizeof(Sailing::id)));
+}
+
+//------------------------------------------------------------------------
+static uint64_t toCapacityField(double value, uint64_t max)
+// Clamps a value into an unsigned capacity field.
+{
+    if (!(value > 0)) return 0;
+    return value >= static_cast<double>(max) ? max : static_cast<uint64_t>(value);
+}
+
+//------------------------------------------------------------------------
+static uint64_t packCapacity(const Sailing &s, uint32_t version)
+// Capacity word for a sailing record's LRL, HRL and reservation count.
+{
+    uint64_t low = toCapacityField(s.LRL, CAPACITY_LANE_MAX);
+    uint64_t high = toCapacityField(s.HRL, CAPACITY_LANE_MAX);
+    uint64_t count = toCapacityField(s.reservationsCount, CAPACITY_COUNT_MAX);
+    return low | high << CAPACITY_LANE_BITS | count << (2 * CAPACITY_LANE_BITS) |
+           static_cast<uint64_t>(version & CAPACITY_VERSION_MASK) << (2 * CAPACITY_LANE_BITS + CAPACITY_COUNT_BITS);
+}
+
+//------------------------------------------------------------------------
+static int32_t capacityLane(uint64_t word, Lane lane)
+// Remaining centimetres of one lane.
+{
+    int shift = lane == Lane::LOW ? 0 : CAPACITY_LANE_BITS;
+    return static_cast<int32_t>((word >> shift) & CAPACITY_LANE_MAX);
+}
+
+//------------------------------------------------------------------------
+static int32_t capacityCount(uint64_t word)
+{
+    return static_cast<int32_t>((word >> (2 * CAPACITY_LANE_BITS)) & CAPACITY_COUNT_MAX);
+}
+
+//------------------------------------------------------------------------
+static uint32_t capacityVersion(uint64_t word)
+{
+    return static_cast<uint32_t>(word >> (2 * CAPACITY_LANE_BITS + CAPACITY_COUNT_BITS));
+}
+
+//------------------------------------------------------------------------
+static uint64_t withLane(uint64_t word, Lane lane, int32_t centimetres, int countDelta)
+// The word with one lane set, the count moved by countDelta and the version bumped.
+{
+    int shift = lane == Lane::LOW ? 0 : CAPACITY_LANE_BITS;
+    word &= ~(CAPACITY_LANE_MAX << shift);
+    word |= static_cast<uint64_t>(centimetres) << shift;
+
+    uint64_t count = toCapacityField(capacityCount(word) + countDelta, CAPACITY_COUNT_MAX);
+    word &= ~(CAPACITY_COUNT_MAX << (2 * CAPACITY_LANE_BITS));
+    word |= count << (2 * CAPACITY_LANE_BITS);
+
+    uint64_t version = (capacityVersion(word) + 1) & CAPACITY_VERSION_MASK;
+    word &= ~(static_cast<uint64_t>(CAPACITY_VERSION_MASK) << (2 * CAPACITY_LANE_BITS + CAPACITY_COUNT_BITS));
+    return word | version << (2 * CAPACITY_LANE_BITS + CAPACITY_COUNT_BITS);
+}
+
+//------------------------------------------------------------------------
+static bool newerVersion(uint32_t candidate, uint32_t current)
+// Serial-number comparison of 12-bit versions (wraps around).
+{
+    uint32_t ahead = (candidate - current) & CAPACITY_VERSION_MASK;
+    return ahead != 0 && ahead < (CAPACITY_VERSION_MASK + 1) / 2;
+}
+
+//------------------------------------------------------------------------
+static SailingCapacity *attachCapacity(uint32_t slot)
+// Counter of the sailing in slot, created from the record if the sailing
+// has none yet. Caller holds sailingMutex exclusively.
+{
+    const Sailing &s = sailingTable[slot];
+    auto [it, created] = sailingCapacities.try_emplace(sailingKey(s.id));
+    if (created) it->second.live.store(packCapacity(s, 0), memory_order_relaxed);
+    if (slotCapacity.size() <= slot) slotCapacity.resize(slot + 1, nullptr);
+    slotCapacity[slot] = &it->second;
+    ++it->second.copies;
+    return &it->second;
+}
+
+//------------------------------------------------------------------------
+static uint32_t *directEntry(uint32_t code, bool create)
+// Entry of the direct table for an encoded ID; with create, a block is
+// added for an unseen terminal. Caller holds sailingMutex.
+{
+    uint32_t terminal = code >> 10;
+    size_t block = 0;
+    while (block < terminalCodes.size() && terminalCodes[block] != terminal) ++block;
+    if (block == terminalCodes.size())
+    {
+        if (!create) return nullptr;
+        terminalCodes.push_back(terminal);
+        directSlots.resize(directSlots.size() + SAILING_SLOTS_PER_TERMINAL, 0);
+    }
+    return &directSlots[block * SAILING_SLOTS_PER_TERMINAL + (code & 1023)];
+}
+
+//------------------------------------------------------------------------
+static void indexSailingSlot(uint32_t slot)
+// Makes the sailing in slot reachable by ID. When an ID is stored twice the
+// first record wins, as a scan would. Every stored ID was decoded from a
+// packed record, so it encodes. Caller holds sailingMutex.
+{
+    uint32_t code;
+    if (!encodeSailingID(sailingTable[slot].id, code)) return;
+    uint32_t *entry = directEntry(code, true);
+    if (*entry == 0) *entry = slot + 1;
+}
+
+//------------------------------------------------------------------------
+static void unindexSailing(const char *id)
+// Removes an ID from the lookup tables. Caller holds sailingMutex.
+{
+    uint32_t code;
+    if (!encodeSailingID(id, code)) return;
+    if (uint32_t *entry = directEntry(code, false)) *entry = 0;
+}
+
+//------------------------------------------------------------------------
+static void loadSailingTable()
+// Reads sailings.dat into the table in one pass. Caller holds sailingMutex.
+{
+    sailingTable.clear();
+    sailingTable.reserve(sailingStore.size());
+    sailingStore.scanBlocks([](const SailingRecord *block, size_t, size_t n) {
+        for (size_t i = 0; i < n; ++i) sailingTable.push_back(SailingCodec::decode(block[i]));
+        return true;
+    });
+    terminalCodes.clear();
+    directSlots.clear();
+    liveSailings = 0;
+    slotCapacity.assign(sailingTable.size(), nullptr);
+    for (auto &entry : sailingCapacities) entry.second.copies = 0;  // Recounted below
+    for (uint32_t slot = 0; slot < sailingTable.size(); ++slot)
+    {
+        if (sailingTable[slot].id[0] == '\0') continue;  // Tombstone
+        indexSailingSlot(slot);
+        attachCapacity(slot);  // Existing counters (after compaction) are kept
+        ++liveSailings;
+    }
+    dirtySlots.clear();
+    slotDirty.assign(sailingTable.size(), false);
+}
+
+//------------------------------------------------------------------------
+static void writeBackSailingTable()
+// Copies every dirty entry to its slot in sailings.dat. Caller holds sailingMutex.
+{
+    sort(dirtySlots.begin(), dirtySlots.end());  // Ascending positions: sequential pages
+    for (uint32_t slot : dirtySlots)
+    {
+        if (!slotDirty[slot]) continue;  // Deleted since it was changed
+        sailingStore.write(slot, sailingTable[slot]);
+        slotDirty[slot] = false;
+    }
+    dirtySlots.clear();
+}
+
+//------------------------------------------------------------------------
+static long findSailingSlot(const char *id)
+// Table slot of a sailing ID, or -1. Caller holds sailingMutex.
+{
+    uint32_t code;
+    if (!encodeSailingID(id, code)) return -1;  // Not a storable ID, so not stored
+    const uint32_t *entry = directEntry(code, false);
+    return entry == nullptr || *entry == 0 ? -1 : static_cast<long>(*entry) - 1;
+}
 
 //------------------------------------------------------------------------
 void initializeSailingStorage()
-// Initializes the sailing storage by opening or creating the sailings.dat file.
-// Ensures the file is available for read and write operations.
-{
-    // Attempt to open the file for reading and writing
-    sailingFile.open("sailings.dat", ios::binary | ios::in | ios::out);
-    if (!sailingFile.is_open()) 
-    {
-        // If the file does not exist, create it
-        ofstream createFile("sailings.dat", ios::binary);
-        createFile.close();
-        sailingFile.clear();
-        sailingFile.open("sailings.dat", ios::binary | ios::in | ios::out);
-        if (!sailingFile.is_open()) 
-        {
-            cerr << "Error: Failed to create sailings.dat file." << endl;
-        }
+// Initializes the sailing storage by opening or creating the sailings.dat file
+// and loading it into the in-memory sailing table.
+{
+    unique_lock<shared_mutex> lock(sailingMutex);
+    // Tombstoned slots are not reused so new sailings always go last
+    if (!sailingStore.open(SAILING_FILE)) 
+    {
+        cerr << "Error: Failed to create sailings.dat file." << endl;
+        return;
     }
+    loadSailingTable();
 }
 
 //------------------------------------------------------------------------
 void shutdownSailingStorage()
-// Closes the sailing data file if it is open, ensuring resources are released.
+// Writes back dirty sailings and closes the sailing data file.
+{
+    unique_lock<shared_mutex> lock(sailingMutex);
+    if (sailingStore.isOpen()) writeBackSailingTable();
+    sailingStore.close();  // Flush and trim the mapped file
+    sailingTable.clear();
+    terminalCodes.clear();
+    directSlots.clear();
+    liveSailings = 0;
+    dirtySlots.clear();
+    slotDirty.clear();
+    sailingAggregates.clear();
+    vesselCapacities.clear();
+    slotCapacity.clear();
+    sailingCapacities.clear();
+}
+
+//------------------------------------------------------------------------
+static bool applySailingAdd(const Sailing &s, bool replaying)
+// Appends a sailing record (WAL SAILING_ADD), writing through to sailings.dat.
+// During replay the record is skipped if its ID is already stored.
+{
+    unique_lock<shared_mutex> lock(sailingMutex);
+    if (replaying && findSailingSlot(s.id) >= 0) return true;
+
+    size_t slot;
+    if (!sailingStore.append(s, &slot)) return false;  // Grows the mapping when the current chunk is full
+    sailingTable.push_back(s);
+    slotDirty.push_back(false);
+    indexSailingSlot(static_cast<uint32_t>(slot));
+    attachCapacity(static_cast<uint32_t>(slot));
+    ++liveSailings;
+    return true;
+}
+
+//------------------------------------------------------------------------
+static bool handleNamesSailing(const RecordHandle &handle, const char *id)
+// True if the handle still names the sailing with this ID. Caller holds sailingMutex.
+{
+    return sailingStore.isCurrent(handle) &&
+           strncmp(sailingTable[handle.slot].id, id, sizeof(Sailing::id)) == 0;
+}
+
+//------------------------------------------------------------------------
+static void replaceSailingEntry(uint32_t pos, const Sailing &s)
+// Replaces a table entry and marks it dirty. Caller holds sailingMutex.
 {
-    if (sailingFile.is_open()) 
+    sailingTable[pos] = s;
+    if (!slotDirty[pos])
     {
-        sailingFile.close();  // Close the file handle
+        slotDirty[pos] = true;
+        dirtySlots.push_back(pos);
     }
 }
 
 //------------------------------------------------------------------------
-bool addSailing(const Sailing &s)
-// Appends a new sailing record to the end of the sailings.dat file.
-// Returns true if the write operation is successful, false otherwise.
+static void replaceSailingRecord(uint32_t pos, const Sailing &s)
+// Replaces a whole record; its capacity replaces the live counter too.
+// Caller holds sailingMutex exclusively.
 {
-    if (!sailingFile.is_open()) return false;  // Check if file is initialized
-    sailingFile.clear();
-    sailingFile.seekp(0, ios::end);  // Move to the end of the file for appending
-    sailingFile.write(reinterpret_cast<const char*>(&s), sizeof(Sailing));
-    return sailingFile.good();  // Return the status of the write operation
+    replaceSailingEntry(pos, s);
+    SailingCapacity *capacity = slotCapacity[pos];
+    uint32_t version = (capacityVersion(capacity->live.load()) + 1) & CAPACITY_VERSION_MASK;
+    capacity->live.store(packCapacity(s, version));
+    capacity->loggedVersion = version;
+    capacity->versionKnown = true;
 }
 
 //------------------------------------------------------------------------
-bool deleteSailing(const char *id)
-// Deletes a sailing record by ID using the swap-last-record method.
-// The target record is overwritten with the last record, and the file is truncated.
+static bool applySailingUpdate(const Sailing &s)
+// Replaces the table entry with the same ID (WAL SAILING_UPDATE) and marks
+// it dirty; sailings.dat is updated at the next write-back.
 {
-    sailingFile.clear();
-    sailingFile.seekg(0, ios::beg);  // Rewind to the beginning of the file
+    unique_lock<shared_mutex> lock(sailingMutex);
+    long pos = findSailingSlot(s.id);
+    if (pos < 0) return false;  // not found
 
-    streamoff targetIndex = -1;  // Index of the record to delete
-    streamoff lastIndex = -1;    // Index of the last record in the file
-    streamoff idx = 0;           // Current record index
-    Sailing current;             // Buffer for reading records
+    replaceSailingRecord(static_cast<uint32_t>(pos), s);
+    return true;
+}
 
-    // Loop goal: Find the target record and the last record
-    while (sailingFile.read(reinterpret_cast<char*>(&current), sizeof(Sailing))) 
+//------------------------------------------------------------------------
+static bool applySailingUpdateAt(const RecordHandle &handle, const Sailing &s)
+// SAILING_UPDATE through a handle: no lookup while the handle is current,
+// otherwise (e.g. compaction ran before the commit) by ID.
+{
     {
-        if (strncmp(current.id, id, sizeof(current.id)) == 0) 
+        unique_lock<shared_mutex> lock(sailingMutex);
+        if (handleNamesSailing(handle, s.id))
         {
-            targetIndex = idx;  // Mark the target record's index
+            replaceSailingRecord(handle.slot, s);
+            return true;
         }
-        lastIndex = idx;  // Update the last record's index
-        idx++;
     }
+    return applySailingUpdate(s);
+}
+
+//------------------------------------------------------------------------
+static void compactSailingStorage()
+// Background task: rewrites sailings.dat without tombstones, keeping order.
+// Slots are renumbered, so the table is reloaded from the compacted file.
+{
+    unique_lock<shared_mutex> lock(sailingMutex);
+    if (!sailingStore.isOpen() || !sailingStore.needsCompaction()) return;
+
+    writeBackSailingTable();  // Dirty entries must reach the file before it is rewritten
+    if (!sailingStore.compact())
+    {
+        cerr << "Error: Failed to compact sailings.dat file." << endl;
+    }
+    loadSailingTable();
+}
+
+//------------------------------------------------------------------------
+static long findDuplicateSailingSlot(const string &key)
+// First live slot still holding an ID, by a scan of the table: an ID can
+// be stored twice, and its copies share one counter and one aggregate.
+// Only worth calling while the counter's copies is above zero.
+// Caller holds sailingMutex.
+{
+    for (size_t slot = 0; slot < sailingTable.size(); ++slot)
+    {
+        if (sailingKey(sailingTable[slot].id) == key) return static_cast<long>(slot);
+    }
+    return -1;
+}
 
-    if (targetIndex >= 0 && targetIndex != lastIndex) 
+//------------------------------------------------------------------------
+static void removeSailingSlot(long targetIndex, const char *id)
+// Tombstones the sailing in a table slot, writing through; no other record
+// moves. The ID's counter and aggregate go only with its last copy; the
+// table is scanned for the next copy only when the ID had more than one.
+// Caller holds sailingMutex.
+{
+    const string key = sailingKey(id);
+    unindexSailing(key.c_str());
+    SailingCapacity *capacity = slotCapacity[targetIndex];
+    bool otherCopies = capacity != nullptr && --capacity->copies > 0;
+    slotCapacity[targetIndex] = nullptr;
+    --liveSailings;
+    sailingStore.erase(static_cast<size_t>(targetIndex));
+    sailingTable[targetIndex] = sailingStore.at(static_cast<size_t>(targetIndex));  // Tombstone in the table too
+    slotDirty[targetIndex] = false;  // A pending change dies with the record
+
+    long duplicate = otherCopies ? findDuplicateSailingSlot(key) : -1;
+    if (duplicate >= 0)
+    {
+        indexSailingSlot(static_cast<uint32_t>(duplicate));  // The next copy answers lookups now
+    }
+    else
+    {
+        sailingAggregates.erase(key);
+        sailingCapacities.erase(key);
+    }
+    if (sailingStore.needsCompaction())
     {
-        // Read the last record to overwrite the target
-        Sailing lastRec;
-        sailingFile.clear();
-        sailingFile.seekg(lastIndex * sizeof(Sailing), ios::beg);
-        sailingFile.read(reinterpret_cast<char*>(&lastRec), sizeof(Sailing));
+        scheduleBackgroundTask(SAILING_FILE, compactSailingStorage);
+    }
+}
 
-        // Overwrite the target record with the last record
-        sailingFile.clear();
-        sailingFile.seekp(targetIndex * sizeof(Sailing), ios::beg);
-        sailingFile.write(reinterpret_cast<const char*>(&lastRec), sizeof(Sailing));
-        sailingFile.flush();
+//------------------------------------------------------------------------
+static bool applySailingDelete(const char *id)
+// Deletes a sailing record by ID (WAL SAILING_DELETE).
+{
+    unique_lock<shared_mutex> lock(sailingMutex);
+    long targetIndex = findSailingSlot(id);  // Index of the record to delete
+    if (targetIndex < 0) return true;  // Nothing to remove
+    removeSailingSlot(targetIndex, id);
+    return true;
+}
+
+//------------------------------------------------------------------------
+static bool applySailingDeleteAt(const RecordHandle &handle, const char *id)
+// SAILING_DELETE through a handle, falling back to the ID if it went stale.
+{
+    {
+        unique_lock<shared_mutex> lock(sailingMutex);
+        if (handleNamesSailing(handle, id))
+        {
+            removeSailingSlot(handle.slot, id);
+            return true;
+        }
     }
+    return applySailingDelete(id);
+}
+
+//------------------------------------------------------------------------
+static bool applySailingCapacity(const SailingCapacityRecord &record, bool replaying)
+// Copies a logged capacity word into the table entry (WAL SAILING_CAPACITY)
+// unless a newer version is already there. At run time the live counter
+// is ahead of the log already; during replay it is set to the word too.
+{
+    unique_lock<shared_mutex> lock(sailingMutex);
+    long pos = findSailingSlot(record.id);
+    if (pos < 0) return true;  // Sailing deleted since
+    SailingCapacity *capacity = slotCapacity[pos];
+
+    uint32_t version = capacityVersion(record.capacity);
+    if (capacity->versionKnown && !newerVersion(version, capacity->loggedVersion)) return true;
+    capacity->loggedVersion = version;
+    capacity->versionKnown = true;
+    if (replaying) capacity->live.store(record.capacity);
 
-    // Truncate the file to remove the last record
-    sailingFile.close();
-    filesystem::resize_file("sailings.dat", static_cast<size_t>((lastIndex) * sizeof(Sailing)));
-    // Reopen the file for further operations
-    sailingFile.open("sailings.dat", ios::binary | ios::in | ios::out);
+    Sailing updated = sailingTable[pos];
+    updated.LRL = capacityLane(record.capacity, Lane::LOW);
+    updated.HRL = capacityLane(record.capacity, Lane::HIGH);
+    updated.reservationsCount = capacityCount(record.capacity);
+    replaceSailingEntry(static_cast<uint32_t>(pos), updated);
     return true;
 }
 
 //------------------------------------------------------------------------
-bool updateSailing(const Sailing &s) {
-    if (!sailingFile.is_open()) return false;
-    sailingFile.clear();
-    sailingFile.seekg(0, std::ios::beg);
-    Sailing temp;
-    while (sailingFile.read(reinterpret_cast<char*>(&temp), sizeof(Sailing))) {
-        auto pos = sailingFile.tellg() - static_cast<std::streamoff>(sizeof(Sailing));
-        if (std::strncmp(temp.id, s.id, sizeof(temp.id)) == 0) {
-            sailingFile.seekp(pos);
-            sailingFile.write(reinterpret_cast<const char*>(&s), sizeof(Sailing));
-            return sailingFile.good();
+static bool logSailingCapacity(const char *id, uint64_t word)
+// Logs a capacity change made to the live counter.
+{
+    SailingCapacityRecord record{};
+    memcpy(record.id, id, strnlen(id, sizeof(record.id) - 1));
+    record.capacity = word;
+    return logMutation(WalOp::SAILING_CAPACITY, &record, sizeof(record),
+                       [record]() { return applySailingCapacity(record, false); });
+}
+
+//------------------------------------------------------------------------
+bool applySailingLogOperation(WalOp op, const char *payload, size_t length)
+// Re-applies one logged sailing operation during startup replay.
+{
+    Sailing s;
+    switch (op)
+    {
+        case WalOp::SAILING_ADD:
+            if (length != sizeof(Sailing)) return false;
+            memcpy(&s, payload, sizeof(s));
+            return applySailingAdd(s, true);
+        case WalOp::SAILING_UPDATE:
+            if (length != sizeof(Sailing)) return false;
+            memcpy(&s, payload, sizeof(s));
+            applySailingUpdate(s);
+            return true;  // A later delete may already have removed it
+        case WalOp::SAILING_DELETE:
+        {
+            char id[sizeof(Sailing::id)] = {};
+            memcpy(id, payload, min(length, sizeof(id) - 1));
+            return applySailingDelete(id);
+        }
+        case WalOp::SAILING_CAPACITY:
+        {
+            if (length != sizeof(SailingCapacityRecord)) return false;
+            SailingCapacityRecord record;
+            memcpy(&record, payload, sizeof(record));
+            return applySailingCapacity(record, true);
         }
+        default:
+            return true;  // Not a sailing operation
+    }
+}
+
+//------------------------------------------------------------------------
+void syncSailingStorage()
+// Writes back dirty sailings and forces sailings.dat to disk for a
+// write-ahead log checkpoint.
+{
+    unique_lock<shared_mutex> lock(sailingMutex);  // Write-back clears the dirty list
+    if (!sailingStore.isOpen()) return;
+    writeBackSailingTable();
+    sailingStore.sync();
+}
+
+//------------------------------------------------------------------------
+bool addSailing(const Sailing &s)
+// Appends a new sailing record to the end of the sailings.dat file.
+// Returns true if the write operation is successful, false otherwise.
+{
+    if (!sailingStore.isOpen()) return false;  // Check if file is initialized
+    return logMutation(WalOp::SAILING_ADD, &s, sizeof(s), [s]() { return applySailingAdd(s, false); });
+}
+
+//------------------------------------------------------------------------
+bool deleteSailing(const char *id)
+// Deletes a sailing record by ID. The change is logged before sailings.dat is touched.
+{
+    char key[sizeof(Sailing::id)] = {};
+    strncpy(key, id, sizeof(key) - 1);
+    string target(key);
+    return logMutation(WalOp::SAILING_DELETE, key, sizeof(key), [target]() { return applySailingDelete(target.c_str()); });
+}
+
+//------------------------------------------------------------------------
+bool deleteSailing(const RecordHandle &handle)
+// Deletes the sailing a handle names; the tombstone is a positional write.
+{
+    char key[sizeof(Sailing::id)] = {};
+    {
+        shared_lock<shared_mutex> lock(sailingMutex);
+        if (!sailingStore.isCurrent(handle)) return false;  // Deleted or moved since the lookup
+        memcpy(key, sailingTable[handle.slot].id, sizeof(key) - 1);
+    }
+    string target(key);
+    return logMutation(WalOp::SAILING_DELETE, key, sizeof(key),
+                       [handle, target]() { return applySailingDeleteAt(handle, target.c_str()); });
+}
+
+//------------------------------------------------------------------------
+bool updateSailing(const Sailing &s) {
+    {
+        shared_lock<shared_mutex> lock(sailingMutex);
+        if (findSailingSlot(s.id) < 0) return false;  // not found
     }
-    return false;  // not found
+    return logMutation(WalOp::SAILING_UPDATE, &s, sizeof(s), [s]() { return applySailingUpdate(s); });
+}
+
+//------------------------------------------------------------------------
+bool updateSailing(const RecordHandle &handle, const Sailing &s)
+// Updates the sailing a handle names; applied to its table entry directly.
+{
+    {
+        shared_lock<shared_mutex> lock(sailingMutex);
+        if (!handleNamesSailing(handle, s.id)) return false;  // Stale handle or ID changed
+    }
+    return logMutation(WalOp::SAILING_UPDATE, &s, sizeof(s), [handle, s]() { return applySailingUpdateAt(handle, s); });
 }
 
 //------------------------------------------------------------------------
@@ -149,54 +634,185 @@ optional<Sailing> getSailingByID(const char *id)
 // Retrieves a sailing record by its ID.
 // Returns the sailing if found, otherwise nullopt.
 {
-    sailingFile.clear();
-    sailingFile.seekg(0, ios::beg);  // Rewind to the start of the file
-    Sailing rec;  // Buffer for reading records
+    shared_lock<shared_mutex> lock(sailingMutex);
+    long pos = findSailingSlot(id);  // Hash lookup in the sailing table
+    if (pos < 0) return nullopt;  // Indicate not found
+    return sailingTable[pos];  // Return the found record
+}
+
+//------------------------------------------------------------------------
+optional<Sailing> getSailingByID(const char *id, RecordHandle &handle)
+// Retrieves a sailing record by its ID together with a handle to it.
+{
+    shared_lock<shared_mutex> lock(sailingMutex);
+    long pos = findSailingSlot(id);
+    if (pos < 0) return nullopt;
+    handle = sailingStore.handle(static_cast<size_t>(pos));
+    return sailingTable[pos];
+}
 
-    // Loop goal: Search sequentially for the matching ID
-    while (sailingFile.read(reinterpret_cast<char*>(&rec), sizeof(Sailing))) 
+//------------------------------------------------------------------------
+optional<Sailing> getSailing(const RecordHandle &handle)
+// Retrieves the sailing a handle names, or nullopt if the handle is stale.
+{
+    shared_lock<shared_mutex> lock(sailingMutex);
+    if (!sailingStore.isCurrent(handle)) return nullopt;
+    return sailingTable[handle.slot];
+}
+
+//------------------------------------------------------------------------
+pair<int32_t, int32_t> getRemainingCapacity(const char *sailingID)
+// Retrieves the remaining capacity (low and high lanes) for a given sailing ID.
+// Returns LRL and HRL in centimetres, or {-1, -1} if not found.
+{
+    shared_lock<shared_mutex> lock(sailingMutex);
+    long pos = findSailingSlot(sailingID);
+    if (pos < 0) return {-1, -1};  // Indicate sailing not found
+    const Sailing &rec = sailingTable[pos];
+    return {rec.LRL, rec.HRL};  // Return low and high remaining lengths
+}
+
+//------------------------------------------------------------------------
+bool reserveLaneSpace(const char *sailingID, int32_t centimetres, bool highLaneOnly, Lane &lane)
+// Takes a vehicle's space from the first lane with room (compare-and-swap
+// on the sailing's capacity word) and logs the new word.
+{
+    uint64_t updated;
     {
-        if (strncmp(rec.id, id, sizeof(rec.id)) == 0) 
+        shared_lock<shared_mutex> lock(sailingMutex);
+        long pos = findSailingSlot(sailingID);
+        if (pos < 0 || centimetres < 0) return false;
+        atomic<uint64_t> &live = slotCapacity[pos]->live;
+
+        // Loop goal: retry until the word is swapped or no lane fits
+        uint64_t current = live.load(memory_order_acquire);
+        do
         {
-            return rec;  // Return the found record
-        }
+            if (!highLaneOnly && capacityLane(current, Lane::LOW) >= centimetres) lane = Lane::LOW;
+            else if (capacityLane(current, Lane::HIGH) >= centimetres) lane = Lane::HIGH;
+            else return false;
+            updated = withLane(current, lane, capacityLane(current, lane) - centimetres, +1);
+        } while (!live.compare_exchange_weak(current, updated, memory_order_acq_rel));
     }
-    return nullopt;  // Indicate not found
+    return logSailingCapacity(sailingID, updated);
 }
 
 //------------------------------------------------------------------------
-pair<float, float> getRemainingCapacity(const char *sailingID)
-// Retrieves the remaining capacity (low and high lanes) for a given sailing ID.
-// Returns a pair of floats representing LRL and HRL, or {-1.0f, -1.0f} if not found.
+bool releaseLaneSpace(const char *sailingID, Lane lane, int32_t centimetres)
+// Gives a vehicle's space back to its lane and logs the new word.
 {
-    sailingFile.clear();
-    sailingFile.seekg(0, ios::beg);  // Rewind to the beginning
-    Sailing rec;  // Buffer for reading records
+    uint64_t updated;
+    {
+        shared_lock<shared_mutex> lock(sailingMutex);
+        long pos = findSailingSlot(sailingID);
+        if (pos < 0 || centimetres < 0) return false;
+        atomic<uint64_t> &live = slotCapacity[pos]->live;
+
+        uint64_t current = live.load(memory_order_acquire);
+        do
+        {
+            int64_t remaining = capacityLane(current, lane) + static_cast<int64_t>(centimetres);
+            updated = withLane(current, lane, static_cast<int32_t>(min<int64_t>(remaining, CAPACITY_LANE_MAX)), -1);
+        } while (!live.compare_exchange_weak(current, updated, memory_order_acq_rel));
+    }
+    return logSailingCapacity(sailingID, updated);
+}
 
-    // Loop goal: Find the sailing and extract capacity fields
-    while (sailingFile.read(reinterpret_cast<char*>(&rec), sizeof(Sailing))) 
+//------------------------------------------------------------------------
+void adjustSailingAggregate(const char *sailingID, Lane lane, int32_t vehicleLength, int delta)
+// Applies one reservation's share to its sailing's aggregates.
+{
+    unique_lock<shared_mutex> lock(sailingMutex);
+    SailingAggregate &agg = sailingAggregates[sailingKey(sailingID)];
+    int64_t laneLength = static_cast<int64_t>(vehicleLength + 50) * delta;  // 50 cm buffer per vehicle
+    agg.vehicleCount += delta;
+    if (lane == Lane::LOW) agg.lowLaneUsed += laneLength;
+    else agg.highLaneUsed += laneLength;
+}
+
+//------------------------------------------------------------------------
+void resetSailingAggregates()
+// Clears every sailing's aggregates.
+{
+    unique_lock<shared_mutex> lock(sailingMutex);
+    sailingAggregates.clear();
+}
+
+//------------------------------------------------------------------------
+SailingAggregate getSailingAggregate(const Sailing &s)
+// Returns the sailing's aggregates with its vessel capacity and capacity factor filled in.
+{
+    SailingAggregate agg;
+    string vesselName(s.vesselName, strnlen(s.vesselName, sizeof(s.vesselName)));
+    bool capacityKnown = false;
     {
-        if (strncmp(rec.id, sailingID, sizeof(rec.id)) == 0) 
+        shared_lock<shared_mutex> lock(sailingMutex);
+        auto it = sailingAggregates.find(sailingKey(s.id));
+        if (it != sailingAggregates.end()) agg = it->second;
+        auto cached = vesselCapacities.find(vesselName);
+        if (cached != vesselCapacities.end())
         {
-            return {rec.LRL, rec.HRL};  // Return low and high remaining lengths
+            agg.vesselCapacity = cached->second;
+            capacityKnown = true;
         }
     }
-    return {-1.0f, -1.0f};  // Indicate sailing not found
+
+    // Vessel capacity: one lookup per vessel for the life of the program,
+    // made without holding sailingMutex
+    if (!capacityKnown)
+    {
+        auto v = getVesselByName(vesselName.c_str());
+        if (!v.has_value()) return agg;  // Unknown vessel: CF stays 0 (not cached, the vessel may be added later)
+        agg.vesselCapacity = v->lowCap + v->highCap;
+        unique_lock<shared_mutex> lock(sailingMutex);
+        vesselCapacities.emplace(vesselName, agg.vesselCapacity);
+    }
+
+    // Capacity factor, as the report has always computed it: remaining
+    // lane length less a 0.5 m buffer per vehicle, against total capacity.
+    // Exact in centimetres; only the final ratio is floating point.
+    int64_t remainingCapacity = static_cast<int64_t>(s.LRL) + s.HRL - 50 * static_cast<int64_t>(agg.vehicleCount);
+    if (agg.vesselCapacity > 0)
+    {
+        agg.capacityFactor = static_cast<float>(100.0 * (agg.vesselCapacity - remainingCapacity) / agg.vesselCapacity);
+    }
+    return agg;
 }
 
 //------------------------------------------------------------------------
 vector<Sailing> getAllSailings()
-// Retrieves all sailing records from the file and returns them in a vector.
+// Retrieves all sailing records from the table, in insertion order, and returns them in a vector.
 {
-    vector<Sailing> sailings;  // Vector to hold all sailing records
-    sailingFile.clear();
-    sailingFile.seekg(0, ios::beg);  // Rewind to the start
-    Sailing s;  // Buffer for reading records
+    shared_lock<shared_mutex> lock(sailingMutex);
+    vector<Sailing> result;
+    result.reserve(liveSailings);
+    for (const Sailing &rec : sailingTable)
+    {
+        if (rec.id[0] != '\0') result.push_back(rec);  // Skip tombstones
+    }
+    return result;
+}
 
-    // Read all records into the vector
-    while (sailingFile.read(reinterpret_cast<char*>(&s), sizeof(Sailing))) 
+//------------------------------------------------------------------------
+vector<Sailing> getSailingsNewestFirst(size_t skip, size_t maxCount, size_t &total)
+// Walks the table from its last slot, passing over tombstones and the
+// first skip sailings, and copies at most maxCount of the rest.
+{
+    shared_lock<shared_mutex> lock(sailingMutex);
+    total = liveSailings;
+    vector<Sailing> result;
+    result.reserve(min(maxCount, skip < liveSailings ? liveSailings - skip : 0));
+    // Loop goal: copy the requested range, newest first
+    for (size_t slot = sailingTable.size(); slot > 0 && result.size() < maxCount; --slot)
     {
-        sailings.push_back(s);
+        const Sailing &rec = sailingTable[slot - 1];
+        if (rec.id[0] == '\0') continue;  // Skip tombstones
+        if (skip > 0)
+        {
+            --skip;
+            continue;
+        }
+        result.push_back(rec);
     }
-    return sailings;
-}
\ No newline at end of file
+    return result;
+}
@@ -13,31 +13,53 @@
 #ifndef SAILING_ASM_H
 #define SAILING_ASM_H
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 #include "SailingCommandProcessor.h"
 #include "Vehicle.h"
+#include "RecordHandle.h"
+#include "Reservation.h"
 #include "Sailing.h"
+#include "WriteAheadLog.h"
 
 //-----------------------------------------------
 void initializeSailingStorage();
 // in: none
 // out: none
-// Purpose: Open sailing data file
+// Purpose: Open sailing data file and load it into the in-memory sailing table
 
 //-----------------------------------------------
 void shutdownSailingStorage();
 // in: none
 // out: none
-// Purpose: Close sailing data file
+// Purpose: Write back dirty sailings and close sailing data file
+
+//-----------------------------------------------
+void syncSailingStorage();
+// in: none
+// out: none
+// Purpose: Write back dirty sailings and force sailings.dat to disk
+// (write-ahead log checkpoint)
+
+//-----------------------------------------------
+bool applySailingLogOperation(
+    WalOp op,                 // in: logged operation
+    const char *payload,      // in: operation payload
+    std::size_t length        // in: payload size in bytes
+);
+// out: false if the operation could not be applied
+// Purpose: Re-apply one write-ahead log operation during startup replay;
+// operations of other modules are ignored
 
 //-----------------------------------------------
 bool addSailing(
     const Sailing &s  // in: sailing to add
 );
-// Purpose: Append a new sailing record
+// Purpose: Append a new sailing record (logged; applied on commit inside a transaction)
 
 //-----------------------------------------------
 bool deleteSailing(
@@ -46,7 +68,22 @@ bool deleteSailing(
 // Purpose: Remove a sailing record by ID
 
 //-----------------------------------------------
-bool updateSailing(const Sailing &s);  // in-place update
+bool deleteSailing(
+    const RecordHandle &handle  // in: handle from a lookup
+);
+// out: false if the sailing was deleted or moved since the lookup
+// Purpose: Remove the sailing a handle names, without an ID lookup
+
+//-----------------------------------------------
+bool updateSailing(const Sailing &s);  // in-place update (write-back: reaches sailings.dat at the next checkpoint)
+
+//-----------------------------------------------
+bool updateSailing(
+    const RecordHandle &handle,  // in: handle from a lookup
+    const Sailing &s             // in: new contents; must keep the same ID
+);
+// out: false if the handle is stale or s carries a different ID
+// Purpose: In-place update of the sailing a handle names, without an ID lookup
 
 //-----------------------------------------------
 std::optional<Sailing> getSailingByID(
@@ -56,18 +93,101 @@ std::optional<Sailing> getSailingByID(
 // Purpose: Retrieve a single sailing record
 
 //-----------------------------------------------
-std::pair<float, float> getRemainingCapacity(
+std::optional<Sailing> getSailingByID(
+    const char *id,        // in: ID to look up
+    RecordHandle &handle   // out: handle to the sailing if found
+);
+// out: optional sailing if found
+// Purpose: Same lookup, also returning a handle for a later update or delete
+
+//-----------------------------------------------
+std::optional<Sailing> getSailing(
+    const RecordHandle &handle  // in: handle from a lookup
+);
+// out: the sailing, or nullopt if it was deleted or moved since the lookup
+// Purpose: Read a sailing by handle (no lookup)
+
+//-----------------------------------------------
+std::pair<std::int32_t, std::int32_t> getRemainingCapacity(
     const char *sailingID  // in: ID of sailing
 );
 // out: remaining capacity count
-// Purpose: Get the LRL and HRL in meters. 
+// Purpose: Get the LRL and HRL in centimetres.
 // The first value is the LRL and the second is the HRL
 
+//-----------------------------------------------
+bool reserveLaneSpace(
+    const char *sailingID,     // in: sailing being booked
+    std::int32_t centimetres,  // in: vehicle length plus its buffer, in centimetres
+    bool highLaneOnly,         // in: vehicle too tall for the low lane
+    Lane &lane                 // out: lane the space was taken from
+);
+// out: false if the sailing is unknown or no allowed lane has room (nothing changed)
+// Purpose: Atomically take a vehicle's space, low lane first, and count one
+// more reservation. Lock-free against other bookings: concurrent callers
+// never oversell a lane. The change is logged (inside the caller's
+// transaction, if one is open).
+
+//-----------------------------------------------
+bool releaseLaneSpace(
+    const char *sailingID,     // in: sailing the vehicle was booked on
+    Lane lane,                 // in: lane the vehicle occupied
+    std::int32_t centimetres   // in: vehicle length plus its buffer, in centimetres
+);
+// out: false if the sailing is unknown
+// Purpose: Atomically give a vehicle's space back and count one fewer
+// reservation; logged like reserveLaneSpace
+
+//-----------------------------------------------
+// Struct:  SailingAggregate
+// Purpose: Running per-sailing figures kept current by the reservation
+//          create, cancel and delete paths, so reports need no scans.
+struct SailingAggregate
+{
+    int vehicleCount = 0;        // TV: reservations on the sailing
+    std::int64_t lowLaneUsed = 0;    // centimetres booked in the low lane (vehicle + 50 cm buffer)
+    std::int64_t highLaneUsed = 0;   // centimetres booked in the high lane (vehicle + 50 cm buffer)
+    std::int32_t vesselCapacity = 0; // lowCap + highCap of the sailing's vessel in cm, 0 if unknown
+    float capacityFactor = 0.0f;     // CF: percentage of the vessel's capacity in use
+};
+
+//-----------------------------------------------
+void adjustSailingAggregate(
+    const char *sailingID,       // in: sailing the reservation belongs to
+    Lane lane,                   // in: lane the reservation occupies
+    std::int32_t vehicleLength,  // in: length of the reserved vehicle (centimetres)
+    int delta                    // in: +1 when a reservation is stored, -1 when removed
+);
+// Purpose: Add or remove one reservation's share of a sailing's aggregates
+
+//-----------------------------------------------
+void resetSailingAggregates();
+// Purpose: Forget every reservation's share (before the reservation
+// module re-adds them at startup)
+
+//-----------------------------------------------
+SailingAggregate getSailingAggregate(
+    const Sailing &s  // in: sailing to summarize
+);
+// out: current aggregates of the sailing, including its capacity factor
+// Purpose: O(1) figures for the sailing report; the vessel's capacity is
+// looked up once per vessel and cached
+
 //-----------------------------------------------
 std::vector<Sailing> getAllSailings();
 // out: vector of all sailings
 // Purpose: Retrieve all sailings in the system
 
+//-----------------------------------------------
+std::vector<Sailing> getSailingsNewestFirst(
+    std::size_t skip,       // in: newest sailings to pass over
+    std::size_t maxCount,   // in: most sailings to return
+    std::size_t &total      // out: sailings in the system
+);
+// out: up to maxCount sailings, newest first, after the first skip
+// Purpose: One page of the sailing report, copied under a single shared
+// lock without copying the rest of the table
+
 
 
 #endif // SAILING_ASM_H
@@ -6,19 +6,21 @@
     Revision 2.0: 2025-07-22 - Updated by Arsh Garcha
     Revision 1.0: 2025-07-07 - Created by Brandon Landa-Ahn
     Purpose:
-        Implementation of sailing-related workflows.
+        Implementation of sailing-related workflows. Input is validated here;
+        every lookup and change is a request through the ferry client.
 */
 
 #include <iostream>
 #include <chrono>
 #include <ctime>
 #include <limits>
+#include <vector>
 #include "SailingCommandProcessor.h"
-#include "SailingASM.h"    // addSailing(id)
-#include "VesselASM.h"     // getVesselByName(name)
-#include "ReservationASM.h" // Ensure no conflicts
+#include "FerryClient.h"   // callFerry(op, request, ...)
 #include "MenuUI.h"
 #include "Sailing.h"       // Sailing struct (if needed)
+#include "Units.h"         // toMetres for display
+#include <cstdlib>  // for atoi
 #include <cstring>  // for strlen
 #include <iomanip>  // for std::put_time
 #include <string>
@@ -47,81 +49,84 @@ void createSailing()
     }
 
     // 2) Validate vessel existence
-    auto vesselOpt = getVesselByName(vesselName);
-    if (!vesselOpt.has_value())
+    Vessel vesselUsed;
+    FerryStatus status = callFerry(FerryOp::VESSEL_GET, makeKeyRequest(vesselName), vesselUsed);
+    if (status != FerryStatus::OK)
     {
-        std::cout << "\033[31mError: Vessel not found\n\033[0m";
+        if (status == FerryStatus::NOT_FOUND)
+            std::cout << "\033[31mError: Vessel not found\n\033[0m";
+        else
+            std::cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
         return;
     }
-    Vessel vesselUsed = vesselOpt.value();
 
     // 3) Prompt for terminal
     char terminal[4]; // 3 char for ferry code + null terminator
     std::cout << "\033[1;97mEnter Departure Terminal (3 character ferry code): \033[0m";
     std::cin.getline(terminal, sizeof(terminal));
-    if (!std::cin || std::strlen(terminal) != 3) {
+    if (!std::cin || std::strlen(terminal) != 3 ||
+        !isalpha(terminal[0]) || !isalpha(terminal[1]) || !isalpha(terminal[2])) {
         std::cin.clear();
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); // Clear the entire input buffer
-        std::cout << "\033[31mError: Invalid terminal code\n\033[0m";
+        std::cout << "\033[31mError: Invalid terminal code (3 letters)\n\033[0m";
         return;
     }
 
-    // 4) Prompt for departure date
+    // 4) Prompt for departure date (day of the month, 01-31)
     char departureDate[4]; // Changed from 3 to 4 to allow for overflow detection
     std::cout << "\033[1;97mEnter Departure Date (2 digits): \033[0m";
     std::cin.getline(departureDate, sizeof(departureDate));
-    if (!std::cin || std::strlen(departureDate) != 2 || !isdigit(departureDate[0]) || !isdigit(departureDate[1])) {
+    if (!std::cin || std::strlen(departureDate) != 2 || !isdigit(departureDate[0]) || !isdigit(departureDate[1]) ||
+        std::atoi(departureDate) < 1 || std::atoi(departureDate) > 31) {
         std::cin.clear();
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << "\033[31mError: Invalid date format\n\033[0m";
+        std::cout << "\033[31mError: Invalid date (01-31)\n\033[0m";
         return;
     }
 
-    // 5) Prompt for departure time
+    // 5) Prompt for departure time (hour, 00-23)
     char departureTime[4]; // Changed from 3 to 4 to allow for overflow detection
     std::cout << "\033[1;97mEnter Departure Time (2 digits): \033[0m";
     std::cin.getline(departureTime, sizeof(departureTime));
-    if (!std::cin || std::strlen(departureTime) != 2 || !isdigit(departureTime[0]) || !isdigit(departureTime[1])) {
+    if (!std::cin || std::strlen(departureTime) != 2 || !isdigit(departureTime[0]) || !isdigit(departureTime[1]) ||
+        std::atoi(departureTime) > 23) {
         std::cin.clear();
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << "\033[31mError: Invalid time format\n\033[0m";
+        std::cout << "\033[31mError: Invalid time (00-23)\n\033[0m";
         return;
     }
 
 
-    // 6) Create the Sailing ID and confirm the sailing does not already exist
+    // 6) Create the Sailing ID
     char sailingID[11];
     std::snprintf(sailingID, sizeof(sailingID), "%s-%s-%s", terminal, departureDate, departureTime);
-    if (getSailingByID(sailingID))
+
+    // 7) Add new sailing; the handler confirms the ID is free and starts
+    //    both lanes at the vessel's capacity
+    SailingCreateRequest request;
+    copyKey(request.vesselName, sizeof(request.vesselName), vesselName);
+    copyKey(request.sailingID, sizeof(request.sailingID), sailingID);
+    status = callFerry(FerryOp::SAILING_CREATE, request);
+    if (status == FerryStatus::ALREADY_EXISTS)
     {
         std::cout << "\033[31mError: Sailing ID conflict\n\033[0m";
         return;
     }
-
-    // 7) Add new sailing
-    Sailing newSailing;
-    strncpy(newSailing.id, sailingID, sizeof(newSailing.id) - 1);
-    newSailing.id[sizeof(newSailing.id) - 1] = '\0';
-    strncpy(newSailing.vesselName, vesselName, sizeof(newSailing.vesselName) - 1);
-    newSailing.vesselName[sizeof(newSailing.vesselName) - 1] = '\0';
-    newSailing.LRL = vesselUsed.lowCap;  // Low Remaining Length
-    newSailing.HRL = vesselUsed.highCap; // High Remaining Length
-    newSailing.reservationsCount = 0;    // Initialize reservations count
-
-    vesselOpt = getVesselByName(vesselName);
-    if (vesselOpt.has_value()) {
-        Vessel vessel = vesselOpt.value();
-        newSailing.LRL = vessel.lowCap;
-        newSailing.HRL = vessel.highCap;
-    } else {
+    if (status == FerryStatus::VESSEL_NOT_FOUND)
+    {
         std::cout << "\033[31mError: Vessel lookup failed during sailing creation\n\033[0m";
         return;
     }
-    if (!addSailing(newSailing))
+    if (status == FerryStatus::STORAGE_FAILED)
     {
         std::cout << "\033[31mError: Failed to create sailing.\n\033[0m";
         return;
     }
+    if (status != FerryStatus::OK)
+    {
+        std::cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+        return;
+    }
 
     // 8) Confirmation
     std::cout << "\033[32mSailing Created\n\033[0m";
@@ -158,39 +163,76 @@ void deleteSailing()
         std::cout << "\033[31mError: Sailing ID not named correctly\n\033[0m";
         return;
     }
-    // 3) Validate sailing existence
-    if (!getSailingByID(sailingID))
+    // 3) Delete the sailing; the handler removes its reservations and the
+    //    sailing record itself as one logged transaction
+    FerryStatus status = callFerry(FerryOp::SAILING_DELETE, makeKeyRequest(sailingID));
+    if (status == FerryStatus::NOT_FOUND)
     {
         std::cout << "\033[31mError: Sailing not found\n\033[0m";
         return;
     }
-    // 4) Delete reservations associated with the sailing
-    if (!deleteReservationsBySailingID(sailingID))
+    if (status == FerryStatus::RESERVATIONS_FAILED)
     {
         std::cout << "\033[31mError: Failed to delete reservations\n\033[0m";
         return;
     }
-    // 5) Delete the sailing record
-    if (!deleteSailing(sailingID))
+    if (status == FerryStatus::STORAGE_FAILED)
     {
         std::cout << "\033[31mError: Failed to delete sailing\n\033[0m";
         return;
     }
+    if (status != FerryStatus::OK)
+    {
+        std::cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+        return;
+    }
 
     // Confirmation (Updated message as per your request)
     std::cout << "\033[32mSailing Canceled\n\033[0m";
 }
 
+//-----------------------------------------------
+// helper: fetch one report page (newest sailing first) starting at offset
+static bool fetchReportPage(int offset, int &totalSailings, std::vector<SailingRow> &rows)
+{
+    SailingReportRequest request{static_cast<std::uint32_t>(offset), FERRY_REPORT_PAGE_ROWS};
+    std::vector<char> response;
+    FerryStatus status = callFerry(FerryOp::SAILING_REPORT, &request, sizeof(request), response);
+
+    SailingReportHeader header{};
+    if (status == FerryStatus::OK && response.size() >= sizeof(header))
+    {
+        std::memcpy(&header, response.data(), sizeof(header));
+    }
+    if (status != FerryStatus::OK || response.size() != sizeof(header) + header.count * sizeof(SailingRow))
+    {
+        std::cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+        return false;
+    }
+
+    totalSailings = static_cast<int>(header.total);
+    rows.resize(header.count);
+    if (header.count > 0)
+    {
+        std::memcpy(rows.data(), response.data() + sizeof(header), header.count * sizeof(SailingRow));
+    }
+    return true;
+}
+
 //------------------------------------------------------------------------
 void viewSailingReport()
 // Displays a paginated report of sailing records, showing up to 5 sailings per page.
 // The report includes vessel name, sailing ID, remaining capacities, total vehicles,
 // and capacity factor. Users can choose to load more pages if available.
 {
-    // Retrieve all sailing records from the system
-    auto sailings = getAllSailings();  // Assuming this function returns a list of sailings
-    std::reverse(sailings.begin(), sailings.end());
-    int totalSailings = sailings.size();
+    // Retrieve the first page of sailing records; later pages are fetched
+    // only if the user asks for them
+    int totalSailings = 0;
+    std::vector<SailingRow> rows;
+    if (!fetchReportPage(0, totalSailings, rows))
+    {
+        return;
+    }
 
     if (totalSailings == 0)
     {
@@ -206,6 +248,15 @@ void viewSailingReport()
     tm* localTime = localtime(&now);
 
     while (loadMore && totalSailings > index) {
+        if (index > 0 && !fetchReportPage(index, totalSailings, rows))
+        {
+            return;
+        }
+        if (rows.empty())
+        {
+            break;  // Sailings were deleted since the previous page
+        }
+
         // Print report header with current date and time
         std::cout << "\n\033[32m[VIEW SAILING REPORT]" << std::endl;
         std::cout << std::string(79, '-') << std::endl;
@@ -227,33 +278,18 @@ void viewSailingReport()
              << std::string(79, '-') << std::endl;
 
         // Display details for up to 5 sailings
-        for (int i = 0; i < 5 && index < totalSailings; i++, index++) {
-            const Sailing &s = sailings[index];
-            // Calculate total vehicles reserved for this sailing
-            int TV = countReservationsBySailing(s.id);
-            auto v = getVesselByName(s.vesselName);
-            float CF = 0.0f;
-            if (v.has_value()) {
-                // Calculate the total capacity (sum of low and high lanes)
-                float totalCapacity = v.value().lowCap + v.value().highCap;
-
-                // Calculate remaining capacity (including the buffer for each vehicle)
-                float remainingCapacity = getRemainingCapacity(s.id).first + getRemainingCapacity(s.id).second;
-
-                // Subtract the 0.5m buffer from the remaining capacity
-                remainingCapacity -= 0.5 * TV;  // Subtract buffer for all vehicles (TV is the number of vehicles)
-
-                // Calculate capacity factor (CF) and handle the case where totalCapacity is zero
-                if (totalCapacity > 0) {
-                    CF = ((totalCapacity - remainingCapacity) / totalCapacity) * 100;
-                }
-            }
+        for (size_t i = 0; i < rows.size() && index < totalSailings; i++, index++) {
+            const Sailing &s = rows[i].sailing;
+            // Total vehicles (TV) and capacity factor (CF) come from the
+            // sailing's running aggregates; no per-row scans
+            int TV = rows[i].vehicleCount;
+            float CF = rows[i].capacityFactor;
             std::cout << std::setw(2) << (index + 1) << ")  "  
                       << std::left  << std::setw(27) << s.vesselName  
                       << std::setw(12)   << s.id
                       << std::fixed  << std::right
-                      << std::setw(10)   << std::setprecision(1) << s.LRL
-                      << std::setw(11)   << std::setprecision(1) << s.HRL
+                      << std::setw(10)   << std::setprecision(1) << toMetres(s.LRL)
+                      << std::setw(11)   << std::setprecision(1) << toMetres(s.HRL)
                       << std::setw(6)    << TV
                       << std::setw(7)    << std::setprecision(1) << CF << "%"
                       << "\n";
@@ -316,15 +352,22 @@ void findSailingByID()
         return; // Return to the main menu after error
     }
 
-    // Call the function to fetch sailing by ID
-    auto sailing = getSailingByID(sailingID);
+    // Fetch the sailing and its aggregates by ID
+    SailingRow row;
+    FerryStatus status = callFerry(FerryOp::SAILING_GET, makeKeyRequest(sailingID), row);
 
     // Check if sailing exists
-    if (!sailing)
+    if (status == FerryStatus::NOT_FOUND)
     {
         std::cout << "\033[31mError: No sailings found matching your criteria\n\033[0m";
         return; // Return to the main menu if not found
     }
+    if (status != FerryStatus::OK)
+    {
+        std::cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+        return;
+    }
+    const Sailing *sailing = &row.sailing;
 
     // Display the Sailing Information in the correct format
     std::cout << "\n\033[32m[SAILING REPORT]\n";
@@ -342,26 +385,9 @@ void findSailingByID()
               << std::endl
               << std::string(79, '-') << std::endl;
 
-    // Calculate total vehicles reserved for this sailing (TV = Total Vehicles)
-    int TV = countReservationsBySailing(sailing->id);
-    auto v = getVesselByName(sailing->vesselName);
-    float CF = 0.0f;
-
-    if (v.has_value()) {
-        // Calculate the total capacity (sum of low and high lanes)
-        float totalCapacity = v.value().lowCap + v.value().highCap;
-
-        // Calculate remaining capacity (including the buffer for each vehicle)
-        float remainingCapacity = getRemainingCapacity(sailing->id).first + getRemainingCapacity(sailing->id).second;
-
-        // Subtract the 0.5m buffer from the remaining capacity
-        remainingCapacity -= 0.5 * TV;  // Subtract buffer for all vehicles (TV is the number of vehicles)
-
-        // Calculate capacity factor (CF) and handle the case where totalCapacity is zero
-        if (totalCapacity > 0) {
-            CF = ((totalCapacity - remainingCapacity) / totalCapacity) * 100;
-        }
-    }
+    // Total vehicles (TV = Total Vehicles) and capacity factor from the sailing's aggregates
+    int TV = row.vehicleCount;
+    float CF = row.capacityFactor;
 
     // Output the specific sailing's details (only one sailing will be displayed)
     std::cout << " ";
@@ -369,8 +395,8 @@ void findSailingByID()
               << std::left  << std::setw(27) << sailing->vesselName
               << std::setw(12)   << sailing->id
               << std::fixed  << std::right
-              << std::setw(10)   << std::setprecision(1) << sailing->LRL
-              << std::setw(11)   << std::setprecision(1) << sailing->HRL
+              << std::setw(10)   << std::setprecision(1) << toMetres(sailing->LRL)
+              << std::setw(11)   << std::setprecision(1) << toMetres(sailing->HRL)
               << std::setw(6)    << TV
               << std::setw(7)    << std::setprecision(1) << CF << "%"
               << "\n";
@@ -388,3 +414,68 @@ void findSailingByID()
     }
     return;
 }
+
+//-----------------------------------------------
+// helper: prompt for a sailing ID under a screen title; false if malformed
+static bool promptSailingID(const char *title, char (&sailingID)[11])
+{
+    std::cout << "\n\033[94m[\033[96m" << title << "\033[94m]\n"
+              << "\033[94m-------------------------------------------------------------------------------\n";
+    std::cout << "\033[1;97mEnter Sailing ID (format: XXX-DD-HH): \033[0m";
+    std::cin >> std::setw(sizeof(sailingID)) >> sailingID;
+
+    if (strlen(sailingID) != 9 ||
+        !isalpha(sailingID[0]) || !isalpha(sailingID[1]) || !isalpha(sailingID[2]) ||
+        !isdigit(sailingID[4]) || !isdigit(sailingID[5]) ||
+        !isdigit(sailingID[7]) || !isdigit(sailingID[8]))
+    {
+        std::cout << "\033[31mError: Sailing ID not named correctly\n\033[0m";
+        return false;
+    }
+    return true;
+}
+
+//-----------------------------------------------
+// Function: prepareSailingForCheckIn
+// Purpose:  Loads a sailing's reservations for the check-in rush.
+void prepareSailingForCheckIn()
+{
+    char sailingID[11];
+    if (!promptSailingID("PREPARE SAILING FOR CHECK-IN", sailingID)) return;
+
+    PrepareSailingResponse result;
+    FerryStatus status = callFerry(FerryOp::SAILING_PREPARE, makeKeyRequest(sailingID), result);
+    if (status == FerryStatus::NOT_FOUND)
+    {
+        std::cout << "\033[31mError: Sailing not found\n\033[0m";
+        return;
+    }
+    if (status != FerryStatus::OK)
+    {
+        std::cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+        return;
+    }
+    std::cout << "\033[32mSailing Ready for Check-in (" << result.reservations << " reservations)\n\033[0m";
+}
+
+//-----------------------------------------------
+// Function: departSailing
+// Purpose:  Ends a prepared sailing's check-in once it has left.
+void departSailing()
+{
+    char sailingID[11];
+    if (!promptSailingID("MARK SAILING DEPARTED", sailingID)) return;
+
+    FerryStatus status = callFerry(FerryOp::SAILING_DEPART, makeKeyRequest(sailingID));
+    if (status == FerryStatus::NOT_FOUND)
+    {
+        std::cout << "\033[31mError: Sailing not found\n\033[0m";
+        return;
+    }
+    if (status != FerryStatus::OK)
+    {
+        std::cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+        return;
+    }
+    std::cout << "\033[32mSailing Departed\n\033[0m";
+}
@@ -37,4 +37,16 @@ void findSailingByID();
 // out:      none
 // Purpose:  Search for and display a sailing by its unique sailing ID.
 
+//-----------------------------------------------
+void prepareSailingForCheckIn();
+// in:       none
+// out:      none
+// Purpose:  Load a sailing's reservations into memory ahead of its check-in rush.
+
+//-----------------------------------------------
+void departSailing();
+// in:       none
+// out:      none
+// Purpose:  Mark a prepared sailing departed: save its check-ins and release its reservations from memory.
+
 #endif // SAILING_COMMAND_PROCESSOR_H
\ No newline at end of file
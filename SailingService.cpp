@@ -0,0 +1,154 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: SailingService.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the sailing service over VesselASM, SailingASM and
+        ReservationASM. Report rows carry each sailing's running aggregates
+        (TV, CF), so a page costs one table copy and no reservation scans.
+
+        Concurrency: 64 reader-writer lock stripes hashed from the sailing
+        ID; creating or deleting a sailing takes its stripe exclusively,
+        bookings take it shared. The storage modules guard their own
+        tables, so reads take no service lock.
+*/
+
+//============================================
+
+#include <algorithm>
+#include "SailingService.h"
+#include "FixedString.h"
+#include "RecordFormat.h"     // encodeSailingID
+#include "ReservationASM.h"
+#include "SailingASM.h"
+#include "VesselASM.h"
+#include "WriteAheadLog.h"
+
+using namespace std;
+
+//============================================
+
+static const int32_t MAX_LANE_CAPACITY = 360000;  // centimetres (3600 m) per lane
+static const size_t SAILING_LOCK_STRIPES = 64;
+
+static shared_mutex sailingLocks[SAILING_LOCK_STRIPES];
+static mutex vesselLock;                     // vessel name check and add
+
+//-----------------------------------------------
+// helper: report row for a sailing
+static SailingRow makeSailingRow(const Sailing &sailing)
+{
+    SailingAggregate aggregate = getSailingAggregate(sailing);
+    return SailingRow{sailing, aggregate.vehicleCount, aggregate.capacityFactor};
+}
+
+//-----------------------------------------------
+// helper: lock stripe of a sailing ID
+static shared_mutex &sailingStripe(const char *sailingID)
+{
+    return sailingLocks[FixedString<sizeof(Sailing::id)>(sailingID).hash() % SAILING_LOCK_STRIPES];
+}
+
+//-----------------------------------------------
+unique_lock<shared_mutex> SailingService::lockSailing(const char *sailingID)
+{
+    return unique_lock<shared_mutex>(sailingStripe(sailingID));
+}
+
+//-----------------------------------------------
+shared_lock<shared_mutex> SailingService::shareSailing(const char *sailingID)
+{
+    return shared_lock<shared_mutex>(sailingStripe(sailingID));
+}
+
+//-----------------------------------------------
+FerryStatus SailingService::createVessel(const Vessel &vessel)
+{
+    if (vessel.name[0] == '\0' ||
+        vessel.lowCap < 0 || vessel.lowCap > MAX_LANE_CAPACITY ||
+        vessel.highCap < 0 || vessel.highCap > MAX_LANE_CAPACITY)
+    {
+        return FerryStatus::BAD_REQUEST;
+    }
+    lock_guard<mutex> lock(vesselLock);
+    if (getVesselByName(vessel.name)) return FerryStatus::ALREADY_EXISTS;
+    return addVessel(vessel) ? FerryStatus::OK : FerryStatus::STORAGE_FAILED;
+}
+
+//-----------------------------------------------
+FerryStatus SailingService::getVessel(const char *name, Vessel &vessel)
+{
+    optional<Vessel> vesselOpt = getVesselByName(name);
+    if (!vesselOpt) return FerryStatus::NOT_FOUND;
+    vessel = *vesselOpt;
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus SailingService::createSailing(const SailingCreateRequest &request)
+{
+    uint32_t code;
+    if (!encodeSailingID(request.sailingID, code)) return FerryStatus::BAD_REQUEST;  // Stored as its code
+
+    optional<Vessel> vesselOpt = getVesselByName(request.vesselName);
+    if (!vesselOpt) return FerryStatus::VESSEL_NOT_FOUND;
+
+    unique_lock<shared_mutex> lock = lockSailing(request.sailingID);
+    if (getSailingByID(request.sailingID)) return FerryStatus::ALREADY_EXISTS;
+
+    Sailing newSailing{};
+    copyKey(newSailing.id, sizeof(newSailing.id), request.sailingID);
+    copyKey(newSailing.vesselName, sizeof(newSailing.vesselName), request.vesselName);
+    newSailing.LRL = vesselOpt->lowCap;   // Low Remaining Length
+    newSailing.HRL = vesselOpt->highCap;  // High Remaining Length
+    newSailing.reservationsCount = 0;
+    return addSailing(newSailing) ? FerryStatus::OK : FerryStatus::STORAGE_FAILED;
+}
+
+//-----------------------------------------------
+FerryStatus SailingService::deleteSailing(const char *sailingID)
+{
+    unique_lock<shared_mutex> lock = lockSailing(sailingID);
+    RecordHandle sailingHandle;
+    if (!getSailingByID(sailingID, sailingHandle)) return FerryStatus::NOT_FOUND;
+
+    // Reservations of the sailing and the sailing record go as one transaction
+    beginTransaction();
+    if (!deleteReservationsBySailingID(sailingID))
+    {
+        abortTransaction();
+        return FerryStatus::RESERVATIONS_FAILED;
+    }
+    if (!::deleteSailing(sailingHandle) || !commitTransaction())
+    {
+        abortTransaction();
+        return FerryStatus::STORAGE_FAILED;
+    }
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus SailingService::getSailing(const char *sailingID, SailingRow &row)
+{
+    optional<Sailing> sailingOpt = getSailingByID(sailingID);
+    if (!sailingOpt) return FerryStatus::NOT_FOUND;
+    row = makeSailingRow(*sailingOpt);
+    return FerryStatus::OK;
+}
+
+//-----------------------------------------------
+FerryStatus SailingService::getReport(uint32_t offset, uint32_t maxRows, uint32_t &total, vector<SailingRow> &rows)
+{
+    // Newest sailing first, as the report has always listed them
+    size_t sailingCount = 0;
+    vector<Sailing> sailings = getSailingsNewestFirst(offset, maxRows, sailingCount);
+    total = static_cast<uint32_t>(sailingCount);
+    rows.clear();
+    rows.reserve(sailings.size());
+    for (const Sailing &s : sailings)
+    {
+        rows.push_back(makeSailingRow(s));
+    }
+    return FerryStatus::OK;
+}
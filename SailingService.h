@@ -0,0 +1,82 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: SailingService.h
+/*
+    Module: SailingService.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the sailing service: the fleet and schedule rules
+        (vessel registration, sailing creation and deletion, the sailing
+        report) as plain functions. No terminal or socket I/O.
+
+        Text arguments must be null-terminated. Calls are safe from any
+        number of threads: creating or deleting a sailing holds that
+        sailing's lock exclusively, bookings hold it shared (their lane
+        space is taken lock-free), and reads and the report take no lock.
+*/
+
+#ifndef SAILING_SERVICE_H
+#define SAILING_SERVICE_H
+
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+#include "FerryProtocol.h"
+
+namespace SailingService
+{
+    //-----------------------------------------------
+    std::unique_lock<std::shared_mutex> lockSailing(
+        const char *sailingID  // in: sailing about to be created or deleted
+    );
+    // Excludes every booking on the sailing while it is created or deleted.
+
+    //-----------------------------------------------
+    std::shared_lock<std::shared_mutex> shareSailing(
+        const char *sailingID  // in: sailing about to be booked
+    );
+    // Keeps the sailing from being deleted under a booking; bookings on
+    // the same sailing share it. Sailings share a fixed set of lock
+    // stripes, so hold only one at a time.
+
+    //-----------------------------------------------
+    FerryStatus createVessel(
+        const Vessel &vessel  // in: name and lane capacities (centimetres, 0-3600 m each)
+    );
+
+    //-----------------------------------------------
+    FerryStatus getVessel(
+        const char *name,     // in: vessel name
+        Vessel &vessel        // out: the vessel
+    );
+
+    //-----------------------------------------------
+    FerryStatus createSailing(
+        const SailingCreateRequest &request  // in: vessel and new sailing ID
+    );
+    // Adds the sailing with both lanes at the vessel's capacity. The ID
+    // must be a well-formed XXX-DD-HH (BAD_REQUEST otherwise).
+
+    //-----------------------------------------------
+    FerryStatus deleteSailing(
+        const char *sailingID  // in: sailing to remove
+    );
+    // Removes the sailing and all of its reservations in one transaction.
+
+    //-----------------------------------------------
+    FerryStatus getSailing(
+        const char *sailingID,  // in: sailing ID
+        SailingRow &row         // out: the sailing with its TV and CF
+    );
+
+    //-----------------------------------------------
+    FerryStatus getReport(
+        std::uint32_t offset,           // in: first row, newest sailing first
+        std::uint32_t maxRows,          // in: rows wanted
+        std::uint32_t &total,           // out: sailings in the system
+        std::vector<SailingRow> &rows   // out: up to maxRows rows from offset
+    );
+}
+
+#endif // SAILING_SERVICE_H
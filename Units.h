@@ -0,0 +1,45 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: Units.h
+/*
+    Module: Units.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Lengths are stored and computed as whole centimetres (int32) in every
+        record, request and capacity sum, so bookings and cancellations add
+        and subtract exactly. Metres appear only where a clerk types or
+        reads a value; these helpers convert at that edge.
+*/
+
+#ifndef UNITS_H
+#define UNITS_H
+
+#include <cmath>
+#include <cstdint>
+
+//-----------------------------------------------
+// Constants
+static constexpr std::int32_t CENTIMETRES_PER_METRE = 100;
+
+//-----------------------------------------------
+inline std::int32_t toCentimetres(
+    double metres  // in: length typed or stored in metres
+)
+// Nearest whole centimetre; NaN and negative lengths become 0 and lengths
+// past the int32 range are clamped.
+{
+    if (!(metres > 0)) return 0;
+    double centimetres = std::round(metres * CENTIMETRES_PER_METRE);
+    return centimetres >= INT32_MAX ? INT32_MAX : static_cast<std::int32_t>(centimetres);
+}
+
+//-----------------------------------------------
+inline double toMetres(
+    std::int32_t centimetres  // in: stored length
+)
+// For display only; never feed the result back into capacity math.
+{
+    return static_cast<double>(centimetres) / CENTIMETRES_PER_METRE;
+}
+
+#endif // UNITS_H
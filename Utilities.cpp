@@ -8,32 +8,69 @@
     Purpose:
     Provides functions that control the overall lifecycle of the system.
 */
+#include <cstdlib>
+#include <iostream>
 #include "Utilities.h"
+#include "BackgroundTasks.h"
+#include "DataFormat.h"
 #include "SailingASM.h"
 #include "ReservationASM.h"
 #include "VesselASM.h"
 #include "VehicleASM.h"
+#include "WriteAheadLog.h"
+
+static const char* WAL_FILE = "ferry.wal";  // shared reservation/sailing write-ahead log
+
+//-----------------------------------------------
+// helper: route one logged operation to the module that owns it
+static bool applyLoggedOperation(WalOp op, const char* payload, std::size_t length)
+{
+    return applySailingLogOperation(op, payload, length) &&
+           applyReservationLogOperation(op, payload, length);
+}
 
 //===============================================
 // Function: startup
 // in:       none
 // out:      none
-// Purpose:  Initialize all ASM storage modules.
+// Purpose:  Upgrade data files left by an older release, initialize all ASM
+//           storage modules, then replay the write-ahead log so every
+//           committed transaction is reflected in the data files.
 void startup()
 {
+    if (!upgradeDataFiles())
+    {
+        std::cerr << "Error: Data files cannot be used by this release; exiting." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
     initializeSailingStorage();
     initializeReservationStorage();
     initializeVesselStorage();
     initializeVehicleStorage();
+
+    setCheckpointHook([]() {
+        syncSailingStorage();
+        syncReservationStorage();
+    });
+    if (openWriteAheadLog(WAL_FILE))
+    {
+        replayWriteAheadLog(applyLoggedOperation);
+        checkpointWriteAheadLog();  // Replayed changes are now in the data files
+    }
 }
 
 //-----------------------------------------------
 // Function: shutdown
 // in:       none
 // out:      none
-// Purpose:  Shutdown all ASM storage modules in reverse order.
+// Purpose:  Finish background maintenance, then shutdown all ASM storage
+//           modules in reverse order.
 void shutdown()
 {
+    stopBackgroundTasks();
+    checkpointWriteAheadLog();
+    closeWriteAheadLog();
     shutdownVehicleStorage();
     shutdownVesselStorage();
     shutdownReservationStorage();
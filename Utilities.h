@@ -15,14 +15,15 @@
 // Function: startup
 // in:       none
 // out:      none
-// Purpose:  Initialize all ASM storage modules.
+// Purpose:  Initialize all ASM storage modules and replay the write-ahead log.
 void startup();
 
 //-----------------------------------------------
 // Function: shutdown
 // in:       none
 // out:      none
-// Purpose:  Shutdown all ASM storage modules in reverse order.
+// Purpose:  Checkpoint the write-ahead log, then shutdown all ASM storage
+//           modules in reverse order.
 void shutdown();
 
 //-----------------------------------------------
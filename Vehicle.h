@@ -13,11 +13,13 @@
 #ifndef VEHICLE_H
 #define VEHICLE_H
 
+#include <cstdint>
+
 struct Vehicle {
     char licensePlate[11];   // vehicle plate (max 10 + null) \0 marks end of string
     char phone[13];          // contact phone (eg, 604-333-2222 + null)
-    float vehicleLength;     // 4 bytes
-    float vehicleHeight;     // 4 bytes
+    std::int32_t vehicleLength;  // 4 bytes (in centimetres)
+    std::int32_t vehicleHeight;  // 4 bytes (in centimetres)
 }; //32 bytes
 
 #endif
\ No newline at end of file
@@ -10,28 +10,67 @@
         -add vehicle
         -close vehicle data
         -find vehicle by license plate
+        -list vehicles whose plate starts with a prefix
+
+        Data Structure: Binary file with fixed-size Vehicle records, plus an
+                        on-disk B+tree index (vehicles.idx) keyed by license plate
+        Algorithm: B+tree O(log n) plate lookups; ordered leaf scans for prefixes;
+                   a reader-writer lock lets lookups and scans run together
+                   while adds take it exclusively
 */
 
 //============================================
-#include <fstream>
+#include <cstring>
 #include <iostream>
+#include <mutex>
+#include <shared_mutex>
 #include "VehicleASM.h"
 #include "Vehicle.h"
+#include "BPlusTreeIndex.h"
+#include "FixedString.h"
+#include "RecordFormat.h"
+#include "RecordStore.h"
 
 using namespace std;
 
-static fstream vehicleFile;  // file-scope binary stream for vehicle data
+static RecordStore<Vehicle, VehicleCodec> vehicleStore;  // file-scope memory-mapped vehicle data (packed records)
+static BPlusTreeIndex vehicleIndex;  // license plate -> record slot in vehicles.dat
+static shared_mutex vehicleMutex;    // Shared for lookups and scans, exclusive for adds
+
+static const char* VEHICLE_INDEX_FILE = "vehicles.idx";
+
+//-----------------------------------------------
+// helper: rebuild vehicles.idx from a full pass over vehicles.dat.
+// Slots are inserted in file order, so a plate stored twice keeps its
+// earliest record, as the old linear scan did.
+static bool rebuildVehicleIndex()
+{
+    if (!vehicleIndex.rebuild()) return false;
+
+    bool ok = true;
+    vehicleStore.forEachLive([&](size_t slot, const Vehicle &v) {
+        ok = ok && vehicleIndex.insert(v.licensePlate, static_cast<uint32_t>(slot));
+    });
+    return ok;
+}
 
 //============================================
 void initializeVehicleStorage()
 {
-    vehicleFile.open("vehicles.dat", ios::binary | ios::in | ios::out);
-	if (!vehicleFile.is_open()) {
-		cerr << "vehicles.dat not found. Creating new file." << endl;
-		ofstream createFile("vehicles.dat", ios::binary);
-		createFile.close();
-		vehicleFile.open("vehicles.dat", ios::binary | ios::in | ios::out);
+    unique_lock<shared_mutex> lock(vehicleMutex);
+    if (!vehicleStore.open("vehicles.dat")) {
+		cerr << "vehicles.dat could not be opened or created." << endl;
+		return;
 	}
+
+    // Reuse the B+tree if it matches the data file, otherwise rebuild it
+    if (!vehicleIndex.open(VEHICLE_INDEX_FILE, vehicleStore.byteSize()))
+    {
+        if (!rebuildVehicleIndex())
+        {
+            cerr << "Failed to build vehicle index." << endl;
+        }
+    }
 }
 //opens vehicle data for read/write binary access
 //create file if it doesnt exist
@@ -41,49 +80,72 @@ bool addVehicle(
 	const Vehicle &v  // in: vehicle to add
 )
 {
-	if (!vehicleFile.is_open()) {
+	unique_lock<shared_mutex> lock(vehicleMutex);
+	if (!vehicleStore.isOpen()) {
 		cerr << "vehicle file not open." << endl;
 		return false;
 	}
 
-	vehicleFile.seekp(0, ios::end);
-	vehicleFile.write(reinterpret_cast<const char*>(&v), sizeof(Vehicle));
+	size_t slot;
+	if (!vehicleStore.append(v, &slot)) return false;
+	if (vehicleIndex.insert(v.licensePlate, static_cast<uint32_t>(slot))) return true;  // Keep the B+tree in step
 
-	return vehicleFile.good();
+	// The record is stored but the B+tree missed it: rebuild the tree from
+	// the file so the plate is found now, not only after the next restart
+	if (rebuildVehicleIndex()) return true;
+	cerr << "Failed to rebuild vehicle index." << endl;
+	vehicleStore.erase(slot);  // Take the record back so false means not stored
+	return false;
 //appends a new vehicle record to binary file
-//returns true if write succeeds
+//returns true once the record is stored and indexed
 }
 //-----------------------------------------------
 void shutdownVehicleStorage()
 
 {
-    if (vehicleFile.is_open()) {
-		vehicleFile.close();
-	}
+    unique_lock<shared_mutex> lock(vehicleMutex);
+    uint64_t finalSize = vehicleStore.byteSize();
+    vehicleStore.close();
+    vehicleIndex.close(finalSize);  // Mark index clean for next startup
 }
-//close vehicle data file if open
+//close vehicle data file and its index if open
 
 //-----------------------------------------------
 std::optional<Vehicle> getVehicleByLicensePlate(
     const std::string &licensePlate
 )
 {
-    if (!vehicleFile.is_open()) return nullopt;
+    shared_lock<shared_mutex> lock(vehicleMutex);
+    if (!vehicleStore.isOpen()) return nullopt;
 
-    vehicleFile.clear();
-    vehicleFile.seekg(0, ios::beg);
+    uint32_t slot;
+    if (!vehicleIndex.find(licensePlate.c_str(), slot) || slot >= vehicleStore.size()) return nullopt;
 
-    Vehicle temp;
-    while (vehicleFile.read(reinterpret_cast<char*>(&temp), sizeof(Vehicle))) {
-        // Use strncmp to compare C-style strings safely
-        if (strncmp(licensePlate.c_str(), temp.licensePlate, sizeof(temp.licensePlate)) == 0) {
-            return temp;
-        }
-    }
-
-    return nullopt;
+    // Confirm the record really carries the plate (masked compare over the fixed-size field)
+    Vehicle record = vehicleStore.at(slot);
+    if (!FixedString<sizeof(Vehicle::licensePlate)>(licensePlate.c_str()).matches(record.licensePlate)) return nullopt;
+    return record;
 }
-//linear search through binary vehicle file to find a 
-//vehicle with a matching license plate
+//B+tree lookup of the vehicle with a matching license plate
 // returns optional<vehicle> if found or nullopt otherwise
+
+//-----------------------------------------------
+std::vector<Vehicle> getVehiclesByPlatePrefix(
+    const std::string &prefix
+)
+{
+    std::vector<Vehicle> result;
+    shared_lock<shared_mutex> lock(vehicleMutex);
+    if (!vehicleStore.isOpen()) return result;
+
+    // Keys are ordered, so the matches form one run starting at the prefix
+    vehicleIndex.scan(prefix.c_str(), [&](const char *plate, uint32_t slot) {
+        if (strncmp(plate, prefix.c_str(), prefix.size()) != 0) return false;  // Past the run
+        if (slot < vehicleStore.size()) result.push_back(vehicleStore.at(slot));
+        return true;
+    });
+    return result;
+}
+//ordered B+tree range scan over plates beginning with prefix
+// returns the matching vehicles sorted by plate
 //-----------------------------------------------
\ No newline at end of file
@@ -15,6 +15,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 #include "Vehicle.h"    
 
 //-----------------------------------------------
@@ -36,15 +37,17 @@ std::optional<Vehicle> getVehicleByLicensePlate(
 // out: optional vehicle if found
 // Purpose: Retrieve vehicle by license plate
 
+//-----------------------------------------------
+std::vector<Vehicle> getVehiclesByPlatePrefix(
+    const std::string &prefix  // in: leading characters of the plate
+);
+// out: matching vehicles in plate order (empty prefix lists every vehicle)
+// Purpose: Prefix query over the plate index
+
 //-----------------------------------------------
 bool addVehicle(
     const Vehicle &v  // in: vehicle to add
 );
 // Purpose: Append a new vehicle record
 
-//-----------------------------------------------
-void seekToBeginningOfFile(); 
-// in: none
-// out: none
-// Purpose: Reset the file's read/write pointer to the beginning of the binary file
 #endif // VEHICLE_ASM_H
\ No newline at end of file
@@ -11,6 +11,7 @@
 #define VESSEL_H
 
 #include <cstddef>
+#include <cstdint>
 
 //-----------------------------------------------
 // Constants
@@ -19,14 +20,14 @@ static constexpr std::size_t VESSEL_NAME_LEN = 26;  // max characters + null
 //-----------------------------------------------
 // Struct:  Vessel
 // in:      name    – vessel identifier (max 24 chars + '\0')
-//          lowCap  – total low‑lane capacity
-//          highCap – total high‑lane capacity
+//          lowCap  – total low‑lane capacity (centimetres)
+//          highCap – total high‑lane capacity (centimetres)
 // Purpose: Fixed‑length record for binary I/O and ASM storage.
 struct Vessel
 {
     char name[VESSEL_NAME_LEN];
-    int  lowCap;
-    int  highCap;
+    std::int32_t lowCap;
+    std::int32_t highCap;
 };
 
 #endif  // VESSEL_H
\ No newline at end of file
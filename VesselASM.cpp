@@ -1,6 +1,7 @@
 //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 /* 
     Revision History:
+    Revision 3.0: 2026-10-16 - Updated by Team
     Revision 2.0: 2025-08-01 - Updated by Brandon Landa-Ahn
     Revision 1.0: 2025-07-24 - Original By Brandon Landa-Ahn
     Purpose:
@@ -8,49 +9,98 @@
         It provides functions to initialize storage, add vessels, retrieve vessels by name,
         and shut down the storage. Data is stored and retrieved using binary I/O for efficiency.
     Algorithm:
-        - Binary file I/O for reading and writing fixed-size Vessel structs.
-        - Sequential search for vessel lookup by name.
+        - Memory-mapped array of fixed-size Vessel structs (RecordStore).
+        - In-memory catalog: every vessel is loaded at startup into an
+          array ordered by a minimal perfect hash of its name, rebuilt
+          after each add. A lookup is one probe plus a name compare, with
+          no file I/O. If the hash cannot be built (e.g. two names share a
+          64-bit hash), lookups fall back to a sequential search of the file.
+        - Reader-writer lock: lookups share it, adds take it exclusively.
     Data Validation:
         - File open/create success checks.
-        - Name matching using `strncmp`.
+        - Name matching using FixedString (vectorized strncmp-equivalent).
         - Goodbit checks on I/O operations.
 */
 #include <iostream>
-#include <fstream>
-#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
-#include <chrono>
-#include <ctime>
-#include <utility>
 #include "Vessel.h"
 #include "VesselASM.h"
+#include "FixedString.h"
+#include "PerfectHash.h"
+#include "RecordFormat.h"
+#include "RecordStore.h"
 #include <optional>
 #include <cstring>
 
 using namespace std;
 
-static fstream vesselFile;  // Module-scope file handle for vessel storage
+static RecordStore<Vessel, VesselCodec> vesselStore;  // Module-scope memory-mapped vessels.dat (packed records)
+static shared_mutex vesselMutex;  // Shared for lookups, exclusive for adds
+
+using VesselName = FixedString<sizeof(Vessel::name)>;
+static PerfectHash catalogHash;         // vessel name -> catalog slot
+static vector<Vessel> vesselCatalog;    // every vessel, at its catalog slot
+static bool catalogReady = false;       // false if the hash could not be built: lookups search vessels.dat
+
+//------------------------------------------------------------------------
+// helper: rebuild the catalog from vessels.dat. A name stored twice keeps
+// its earliest record, as the old sequential search did. Caller holds
+// vesselMutex exclusively.
+static bool rebuildVesselCatalog()
+{
+    vector<Vessel> vessels;
+    vector<uint64_t> hashes;
+    unordered_set<string> names;
+    vesselStore.forEachLive([&](size_t, const Vessel &v) {
+        if (!names.emplace(v.name, strnlen(v.name, sizeof(v.name))).second) return;
+        vessels.push_back(v);
+        hashes.push_back(VesselName(v.name).hash());
+    });
+
+    vesselCatalog.clear();
+    catalogReady = catalogHash.build(hashes);
+    if (!catalogReady) return false;
+    vesselCatalog.resize(vessels.size());
+    for (size_t i = 0; i < vessels.size(); ++i)
+    {
+        vesselCatalog[catalogHash.slot(hashes[i])] = vessels[i];
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------
+// helper: sequential search of vessels.dat, used while the catalog could
+// not be built; the earliest record with the name wins. Caller holds vesselMutex.
+static optional<Vessel> searchVesselFile(const VesselName &name)
+{
+    for (size_t slot = 0; slot < vesselStore.size(); ++slot)
+    {
+        if (!vesselStore.isLive(slot)) continue;
+        Vessel v = vesselStore.at(slot);
+        if (name.matches(v.name)) return v;
+    }
+    return nullopt;
+}
 
 //------------------------------------------------------------------------
 void initializeVesselStorage()
 // Initializes the vessel storage by opening or creating the vessels.dat file.
 // Ensures the file is available for read and write operations.
 {
-    // Attempt to open the file for reading and writing
-    vesselFile.open("vessels.dat", ios::binary | ios::in | ios::out);
-    if (!vesselFile.is_open()) 
+    unique_lock<shared_mutex> lock(vesselMutex);
+    if (!vesselStore.open("vessels.dat")) 
+    {
+        cerr << "Error: Failed to create vessels.dat file." << endl;
+        // Optional: Could throw an exception or exit gracefully
+    }
+    else if (!rebuildVesselCatalog())
     {
-        // If the file does not exist, create it
-        ofstream createFile("vessels.dat", ios::binary);
-        createFile.close();
-        vesselFile.clear();  // Reset state flags after failed open attempt
-        vesselFile.open("vessels.dat", ios::binary | ios::in | ios::out);
-        if (!vesselFile.is_open()) 
-        {
-            cerr << "Error: Failed to create vessels.dat file." << endl;
-            // Optional: Could throw an exception or exit gracefully
-        }
+        cerr << "Error: Failed to build the vessel catalog; searching vessels.dat instead." << endl;
     }
 }
 
@@ -59,26 +109,31 @@ void shutdownVesselStorage()
 // Closes the vessel data file if it is open, ensuring resources are released.
 // Note: Renamed from 'shutdownVehicleStorage' to match 'initializeVesselStorage'.
 {
-    if (vesselFile.is_open()) 
-    {
-        vesselFile.close();  // Close the file handle
-    }
+    unique_lock<shared_mutex> lock(vesselMutex);
+    vesselStore.close();  // Flush and trim the mapped file
+    catalogHash.clear();
+    vesselCatalog.clear();
+    catalogReady = false;
 }
 
 //------------------------------------------------------------------------
 bool addVessel(const Vessel &v)
-// Appends a new vessel record to the end of the vessels.dat file.
-// Returns true if the write operation is successful, false otherwise.
+// Appends a new vessel record to the end of the vessels.dat file and
+// rebuilds the catalog. Returns true once the record is stored; if the
+// catalog cannot be rebuilt, lookups search the file until it can be.
 {
-    if (!vesselFile.is_open()) 
+    unique_lock<shared_mutex> lock(vesselMutex);
+    if (!vesselStore.isOpen()) 
     {
         cerr << "Error: Vessel storage is not initialized." << endl;
         return false;
     }
-    vesselFile.clear();  // Clear any error flags before operation
-    vesselFile.seekp(0, ios::end);  // Move to the end of the file for appending
-    vesselFile.write(reinterpret_cast<const char*>(&v), sizeof(Vessel));
-    return vesselFile.good();  // Return the status of the write operation
+    if (!vesselStore.append(v)) return false;  // Grows the mapping when the current chunk is full
+    if (!rebuildVesselCatalog())
+    {
+        cerr << "Error: Failed to rebuild the vessel catalog; searching vessels.dat instead." << endl;
+    }
+    return true;  // The vessel is stored either way
 }
 
 //------------------------------------------------------------------------
@@ -86,22 +141,19 @@ std::optional<Vessel> getVesselByName(const char* targetName)
 // Retrieves a vessel record by its name.
 // Returns the vessel if found, otherwise nullopt.
 {
-    if (!vesselFile.is_open()) 
+    shared_lock<shared_mutex> lock(vesselMutex);
+    if (!vesselStore.isOpen()) 
     {
         cerr << "Error: Vessel storage is not initialized." << endl;
         return nullopt;
     }
-    vesselFile.clear();  // Clear any error flags before reading
-    vesselFile.seekg(0, ios::beg);  // Rewind to the start of the file
-    Vessel temp;  // Buffer for reading records
 
-    // Sequentially search for the matching name
-    while (vesselFile.read(reinterpret_cast<char*>(&temp), sizeof(Vessel))) 
-    {
-        if (strncmp(temp.name, targetName, sizeof(temp.name)) == 0) 
-        {
-            return temp;  // Return the found vessel
-        }
-    }
-    return nullopt;  // Indicate vessel not found
-}
\ No newline at end of file
+    VesselName name(targetName);
+    if (!catalogReady) return searchVesselFile(name);
+    if (vesselCatalog.empty()) return nullopt;
+
+    // One probe; a name outside the fleet lands on some other vessel's slot
+    const Vessel &v = vesselCatalog[catalogHash.slot(name.hash())];
+    if (!name.matches(v.name)) return nullopt;  // Indicate vessel not found
+    return v;
+}
@@ -11,8 +11,9 @@
 #include <iostream>
 #include <limits>
 #include "VesselCommandProcessor.h"
-#include "VesselASM.h"    // addVessel(const Vessel&), getVesselByName(const char*)
-#include "Vessel.h"       // struct Vessel { char name[25]; int lowCap; int highCap; };
+#include "FerryClient.h"  // callFerry(VESSEL_GET / VESSEL_CREATE)
+#include "Units.h"
+#include "Vessel.h"       // struct Vessel { char name[25]; int32_t lowCap; int32_t highCap; } (centimetres)
 #include "MenuUI.h"       // For returning to main menu
 
 namespace
@@ -79,11 +80,18 @@ void createVessel()
         return;  // Go back to main menu after error
     }
 
-    if (getVesselByName(v.name))
+    Vessel existing;
+    FerryStatus status = callFerry(FerryOp::VESSEL_GET, makeKeyRequest(v.name), existing);
+    if (status == FerryStatus::OK)
     {
         std::cout << "\033[31mError: Vessel name already exists.\n\033[0m";
         return;
     }
+    if (status != FerryStatus::NOT_FOUND)
+    {
+        std::cout << "\033[31mError: " << ferryStatusMessage(status) << "\n\033[0m";
+        return;
+    }
 
     int intValueLow;
     if (!promptInt("\033[1;97mEnter Total Low Lane Capacity (max 3600): \033[0m", intValueLow) || intValueLow < 0 || intValueLow > 3600)
@@ -94,7 +102,7 @@ void createVessel()
             std::cout << "\033[31mError: Invalid low lane capacity.\n\033[0m";
         return;
     }
-    v.lowCap = intValueLow;
+    v.lowCap = intValueLow * CENTIMETRES_PER_METRE;
 
     int intValueHigh;
     if (!promptInt("\033[1;97mEnter Total High Lane Capacity (max 3600): \033[0m", intValueHigh) || intValueHigh < 0 || intValueHigh > 3600)
@@ -105,10 +113,15 @@ void createVessel()
             std::cout << "\033[31mError: Invalid high lane capacity.\n\033[0m";
         return;
     }
-    v.highCap = intValueHigh;
+    v.highCap = intValueHigh * CENTIMETRES_PER_METRE;
 
-    const Vessel& vesselRef = v;
-    if (!addVessel(vesselRef))
+    status = callFerry(FerryOp::VESSEL_CREATE, v);
+    if (status == FerryStatus::ALREADY_EXISTS)  // Another clerk created it meanwhile
+    {
+        std::cout << "\033[31mError: Vessel name already exists.\n\033[0m";
+        return;
+    }
+    if (status != FerryStatus::OK)
     {
         std::cout << "\033[31mError: failed to save vessel.\n\033[0m";
         return;
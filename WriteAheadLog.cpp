@@ -0,0 +1,389 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: WriteAheadLog.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Implementation of the shared write-ahead log.
+
+        Data Structure: append-only file of transaction entries
+                        {header, operations..., checksum}; each operation is
+                        {op, length, payload}
+        Algorithm: one write() per committed transaction; fsync batched by
+                   group commit (N commits or N milliseconds, whichever first);
+                   replay stops at the first entry whose checksum fails;
+                   checkpoint = sync data files, then truncate the log
+        Concurrency: each thread groups its own transaction (thread-local
+                   state); log appends are serialized by logMutex; a
+                   checkpoint waits for every commit between its log write
+                   and its data file apply (checkpointGate), so the log is
+                   never truncated under a change that has not reached the
+                   data files. Commits that touch the same records must be
+                   serialized by the caller so they apply in log order.
+*/
+
+//============================================
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "WriteAheadLog.h"
+
+using namespace std;
+
+//============================================
+
+static constexpr uint32_t WAL_ENTRY_MAGIC = 0x314C4157;  // "WAL1"
+
+struct WalEntryHeader
+{
+    uint32_t magic;
+    uint32_t sequence;      // increasing transaction number
+    uint32_t opCount;       // operations in this transaction
+    uint32_t payloadBytes;  // bytes of operations following the header
+};
+
+struct WalOpHeader
+{
+    uint8_t op;             // WalOp value
+    uint8_t reserved;
+    uint16_t length;        // payload bytes following this header
+};
+
+static int logFd = -1;                       // append-only log descriptor
+static mutex logMutex;                       // guards the descriptor and group-commit state
+static condition_variable flusherWake;
+static thread flusherThread;                 // fsyncs pending commits every groupMs
+static bool flusherStop = false;
+
+static unsigned groupTxns = WAL_DEFAULT_GROUP_TXNS;
+static unsigned groupMs = WAL_DEFAULT_GROUP_MS;
+static unsigned pendingSync = 0;             // commits written but not yet fsynced
+static chrono::steady_clock::time_point lastSync;
+static uint32_t nextSequence = 1;
+static size_t logBytes = 0;
+static function<void()> checkpointHook;
+static shared_mutex checkpointGate;          // shared: commit in flight; exclusive: checkpoint
+
+// Transaction being grouped by the calling thread
+static thread_local bool inTransaction = false;
+static thread_local vector<char> txnPayload;
+static thread_local uint32_t txnOps = 0;
+static thread_local vector<function<bool()>> txnApplies;
+
+//-----------------------------------------------
+// helper: FNV-1a checksum over a byte range
+static uint32_t checksum(const char *data, size_t length, uint32_t h = 2166136261u)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+//-----------------------------------------------
+// helper: size of the entry at offset if it is complete and its checksum
+// matches, otherwise 0 (a torn or corrupt tail)
+static size_t completeEntryBytes(const vector<char> &log, size_t offset)
+{
+    if (offset + sizeof(WalEntryHeader) + sizeof(uint32_t) > log.size()) return 0;
+    WalEntryHeader header;
+    memcpy(&header, log.data() + offset, sizeof(header));
+    size_t entryBytes = sizeof(header) + header.payloadBytes + sizeof(uint32_t);
+    if (header.magic != WAL_ENTRY_MAGIC || offset + entryBytes > log.size()) return 0;
+
+    uint32_t stored;
+    memcpy(&stored, log.data() + offset + sizeof(header) + header.payloadBytes, sizeof(stored));
+    return stored == checksum(log.data() + offset, sizeof(header) + header.payloadBytes) ? entryBytes : 0;
+}
+
+//-----------------------------------------------
+// helper: write the whole buffer to fd, retrying short writes
+static bool writeAll(const char *data, size_t length, int fd = logFd)
+{
+    while (length > 0)
+    {
+        ssize_t written = ::write(fd, data, length);
+        if (written < 0) return false;
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+//-----------------------------------------------
+// helper: fsync pending commits; caller holds logMutex
+static void syncLocked()
+{
+    if (logFd >= 0 && pendingSync > 0)
+    {
+        fsync(logFd);
+        pendingSync = 0;
+    }
+    lastSync = chrono::steady_clock::now();
+}
+
+//-----------------------------------------------
+// helper: background loop that bounds how long a commit stays unsynced
+static void flusherLoop()
+{
+    unique_lock<mutex> lock(logMutex);
+    while (!flusherStop)
+    {
+        flusherWake.wait_for(lock, chrono::milliseconds(groupMs));
+        if (pendingSync > 0) syncLocked();
+    }
+}
+
+//-----------------------------------------------
+bool openWriteAheadLog(const string &path)
+{
+    if (logFd >= 0) return true;
+    logFd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (logFd < 0)
+    {
+        cerr << "Error: Failed to open write-ahead log " << path << "." << endl;
+        return false;
+    }
+
+    struct stat st;
+    logBytes = fstat(logFd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    lastSync = chrono::steady_clock::now();
+    flusherStop = false;
+    flusherThread = thread(flusherLoop);
+    return true;
+}
+
+//-----------------------------------------------
+void closeWriteAheadLog()
+{
+    if (logFd < 0) return;
+    {
+        lock_guard<mutex> lock(logMutex);
+        flusherStop = true;
+        syncLocked();
+    }
+    flusherWake.notify_all();
+    if (flusherThread.joinable()) flusherThread.join();
+
+    ::close(logFd);
+    logFd = -1;
+    abortTransaction();
+}
+
+//-----------------------------------------------
+void setGroupCommitPolicy(unsigned maxTransactions, unsigned maxDelayMs)
+{
+    lock_guard<mutex> lock(logMutex);
+    groupTxns = maxTransactions == 0 ? 1 : maxTransactions;
+    groupMs = maxDelayMs == 0 ? 1 : maxDelayMs;
+}
+
+//-----------------------------------------------
+void setCheckpointHook(function<void()> hook)
+{
+    checkpointHook = move(hook);
+}
+
+//-----------------------------------------------
+void beginTransaction()
+{
+    abortTransaction();  // Never nest; a dangling transaction is discarded
+    inTransaction = true;
+}
+
+//-----------------------------------------------
+void abortTransaction()
+{
+    inTransaction = false;
+    txnPayload.clear();
+    txnOps = 0;
+    txnApplies.clear();
+}
+
+//-----------------------------------------------
+bool commitTransaction()
+{
+    if (!inTransaction) return true;
+    inTransaction = false;
+    if (txnOps == 0) return true;
+
+    vector<function<bool()>> applies;
+    applies.swap(txnApplies);
+
+    // Build the entry: header, grouped operations, checksum
+    WalEntryHeader header{WAL_ENTRY_MAGIC, 0, txnOps, static_cast<uint32_t>(txnPayload.size())};
+    vector<char> entry(sizeof(header) + txnPayload.size() + sizeof(uint32_t));
+    bool logged = logFd < 0;  // Without a log (e.g. tools, tests) changes apply directly
+    bool checkpointDue = false;
+    shared_lock<shared_mutex> gate(checkpointGate);  // Held until the change is applied
+    {
+        lock_guard<mutex> lock(logMutex);
+        if (logFd >= 0)
+        {
+            header.sequence = nextSequence++;
+            memcpy(entry.data(), &header, sizeof(header));
+            memcpy(entry.data() + sizeof(header), txnPayload.data(), txnPayload.size());
+            uint32_t sum = checksum(entry.data(), sizeof(header) + txnPayload.size());
+            memcpy(entry.data() + sizeof(header) + txnPayload.size(), &sum, sizeof(sum));
+
+            logged = writeAll(entry.data(), entry.size());
+            if (!logged)
+            {
+                // Cut off the torn entry: replay stops at the first incomplete
+                // entry, so anything committed after it would be lost
+                --nextSequence;
+                if (ftruncate(logFd, static_cast<off_t>(logBytes)) != 0)
+                {
+                    cerr << "Error: Failed to trim a torn entry from the log." << endl;
+                }
+            }
+            else
+            {
+                logBytes += entry.size();
+            }
+            checkpointDue = logBytes > WAL_CHECKPOINT_BYTES;
+
+            // Group commit: fsync once enough commits or enough time has accumulated
+            ++pendingSync;
+            auto waited = chrono::steady_clock::now() - lastSync;
+            if (pendingSync >= groupTxns || waited >= chrono::milliseconds(groupMs))
+            {
+                syncLocked();
+            }
+        }
+    }
+    txnPayload.clear();
+    txnOps = 0;
+
+    if (!logged)
+    {
+        cerr << "Error: Failed to write transaction to log." << endl;
+        return false;
+    }
+
+    // The change is in the log, so it may now reach the data files
+    bool applied = true;
+    for (auto &apply : applies)
+    {
+        applied = apply() && applied;
+    }
+    gate.unlock();
+
+    if (checkpointDue) checkpointWriteAheadLog();
+    return applied;
+}
+
+//-----------------------------------------------
+bool logMutation(WalOp op, const void *payload, size_t length, function<bool()> apply)
+{
+    bool autoCommit = !inTransaction;
+    if (autoCommit) beginTransaction();
+
+    WalOpHeader opHeader{static_cast<uint8_t>(op), 0, static_cast<uint16_t>(length)};
+    const char *opBytes = reinterpret_cast<const char*>(&opHeader);
+    txnPayload.insert(txnPayload.end(), opBytes, opBytes + sizeof(opHeader));
+    txnPayload.insert(txnPayload.end(), static_cast<const char*>(payload), static_cast<const char*>(payload) + length);
+    txnApplies.push_back(move(apply));
+    ++txnOps;
+
+    return autoCommit ? commitTransaction() : true;
+}
+
+//-----------------------------------------------
+bool replayWriteAheadLog(const function<bool(WalOp, const char*, size_t)> &apply)
+{
+    if (logFd < 0) return false;
+
+    // Read the whole log; it is bounded by the checkpoint size
+    vector<char> log(logBytes);
+    if (logBytes > 0 && pread(logFd, log.data(), logBytes, 0) != static_cast<ssize_t>(logBytes)) return false;
+
+    bool ok = true;
+    size_t offset = 0;
+    size_t entryBytes;
+    // Loop goal: apply each complete entry in order, stop at a torn tail
+    while ((entryBytes = completeEntryBytes(log, offset)) > 0)
+    {
+        WalEntryHeader header;
+        memcpy(&header, log.data() + offset, sizeof(header));
+        const char *cursor = log.data() + offset + sizeof(header);
+        for (uint32_t i = 0; i < header.opCount; ++i)
+        {
+            WalOpHeader opHeader;
+            memcpy(&opHeader, cursor, sizeof(opHeader));
+            cursor += sizeof(opHeader);
+            ok = apply(static_cast<WalOp>(opHeader.op), cursor, opHeader.length) && ok;
+            cursor += opHeader.length;
+        }
+        if (header.sequence >= nextSequence) nextSequence = header.sequence + 1;
+        offset += entryBytes;
+    }
+    return ok;
+}
+
+//-----------------------------------------------
+bool rewriteWriteAheadLog(const string &fromPath, const string &toPath,
+                          const function<void(WalOp, char*, size_t)> &convert)
+{
+    int fromFd = ::open(fromPath.c_str(), O_RDONLY);
+    if (fromFd < 0) return false;
+    struct stat st;
+    vector<char> log(fstat(fromFd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0);
+    bool ok = log.empty() || pread(fromFd, log.data(), log.size(), 0) == static_cast<ssize_t>(log.size());
+    ::close(fromFd);
+    if (!ok) return false;
+
+    size_t offset = 0;
+    size_t entryBytes;
+    // Loop goal: convert each complete entry in place and reseal it; the torn tail is dropped
+    while ((entryBytes = completeEntryBytes(log, offset)) > 0)
+    {
+        WalEntryHeader header;
+        memcpy(&header, log.data() + offset, sizeof(header));
+        char *cursor = log.data() + offset + sizeof(header);
+        for (uint32_t i = 0; i < header.opCount; ++i)
+        {
+            WalOpHeader opHeader;
+            memcpy(&opHeader, cursor, sizeof(opHeader));
+            cursor += sizeof(opHeader);
+            convert(static_cast<WalOp>(opHeader.op), cursor, opHeader.length);
+            cursor += opHeader.length;
+        }
+        uint32_t sum = checksum(log.data() + offset, sizeof(header) + header.payloadBytes);
+        memcpy(log.data() + offset + sizeof(header) + header.payloadBytes, &sum, sizeof(sum));
+        offset += entryBytes;
+    }
+
+    int toFd = ::open(toPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (toFd < 0) return false;
+    ok = writeAll(log.data(), offset, toFd) && fsync(toFd) == 0;
+    ::close(toFd);
+    return ok;
+}
+
+//-----------------------------------------------
+bool checkpointWriteAheadLog()
+{
+    // No commit may sit between its log write and its apply while the log is dropped
+    unique_lock<shared_mutex> gate(checkpointGate);
+    if (checkpointHook) checkpointHook();  // Data files durable before the log is dropped
+
+    lock_guard<mutex> lock(logMutex);
+    if (logFd < 0) return false;
+    if (ftruncate(logFd, 0) != 0) return false;
+    fsync(logFd);
+    pendingSync = 0;
+    logBytes = 0;
+    return true;
+}
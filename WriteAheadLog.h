@@ -0,0 +1,118 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+// File: WriteAheadLog.h
+/*
+    Module: WriteAheadLog.h
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Declaration of the append-only write-ahead log shared by ReservationASM
+        and SailingASM. Mutations are logged before they reach the data files,
+        several mutations can be grouped into one atomic transaction, and the
+        log is replayed on startup to finish any committed transaction whose
+        data file writes were lost.
+*/
+
+#ifndef WRITE_AHEAD_LOG_H
+#define WRITE_AHEAD_LOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+//-----------------------------------------------
+// Constants
+static constexpr unsigned WAL_DEFAULT_GROUP_TXNS = 16;        // fsync after this many commits
+static constexpr unsigned WAL_DEFAULT_GROUP_MS = 5;           // or after this many milliseconds
+static constexpr std::size_t WAL_CHECKPOINT_BYTES = 4 << 20;  // checkpoint once the log passes 4 MiB
+
+//-----------------------------------------------
+// Enum:    WalOp
+// Purpose: Logged operation types. Every operation is idempotent on replay
+//          (puts/adds are keyed by primary key, deletes ignore missing keys).
+enum class WalOp : std::uint8_t
+{
+    RESERVATION_PUT = 1,                 // payload: Reservation (insert or replace by ID)
+    RESERVATION_DELETE = 2,              // payload: reservation ID (char[21])
+    RESERVATIONS_DELETE_BY_SAILING = 3,  // payload: sailing ID (char[10])
+    SAILING_ADD = 4,                     // payload: Sailing (skipped on replay if already present)
+    SAILING_UPDATE = 5,                  // payload: Sailing (replace by ID)
+    SAILING_DELETE = 6,                  // payload: sailing ID (char[10])
+    SAILING_CAPACITY = 7                 // payload: sailing ID + versioned capacity word (newest version wins)
+};
+
+//-----------------------------------------------
+bool openWriteAheadLog(
+    const std::string &path  // in: log file path
+);
+// Opens (or creates) the log and starts the group-commit flusher.
+
+//-----------------------------------------------
+void closeWriteAheadLog();
+// Forces pending commits to disk, stops the flusher and closes the log.
+
+//-----------------------------------------------
+void setGroupCommitPolicy(
+    unsigned maxTransactions,  // in: fsync once this many commits are pending (1 = every commit)
+    unsigned maxDelayMs        // in: fsync pending commits at least this often
+);
+// Configures group commit. Commits between fsyncs are durable against a
+// process crash but may be lost on power failure.
+
+//-----------------------------------------------
+void setCheckpointHook(
+    std::function<void()> hook  // in: forces every logged data file to disk
+);
+// Called before the log is truncated so no committed change is lost.
+
+//-----------------------------------------------
+void beginTransaction();
+// Starts grouping mutations on the calling thread; every thread has its
+// own transaction. Until commitTransaction() the logged changes are
+// neither written to the log nor applied to the data files.
+
+//-----------------------------------------------
+bool commitTransaction();
+// Appends the grouped mutations as one log entry, then applies them.
+// Returns false if the log write or any apply step failed. Commits from
+// different threads may apply out of log order, so callers serialize
+// commits that change the same records.
+
+//-----------------------------------------------
+void abortTransaction();
+// Discards the grouped mutations without logging or applying them.
+
+//-----------------------------------------------
+bool logMutation(
+    WalOp op,                    // in: operation type
+    const void *payload,         // in: operation payload
+    std::size_t length,          // in: payload size in bytes
+    std::function<bool()> apply  // in: performs the change on the data file
+);
+// Used by the ASMs for every logged change. Inside a transaction the change
+// is queued and true is returned; otherwise it is logged as a one-operation
+// transaction and applied immediately, returning the apply result.
+
+//-----------------------------------------------
+bool replayWriteAheadLog(
+    const std::function<bool(WalOp, const char*, std::size_t)> &apply  // in: re-applies one operation
+);
+// Re-applies every complete transaction in the log, stopping at the first
+// torn or corrupt entry. Returns false if an operation could not be applied.
+
+//-----------------------------------------------
+bool rewriteWriteAheadLog(
+    const std::string &fromPath,                                    // in: closed log to read
+    const std::string &toPath,                                      // in: file to write (replaced)
+    const std::function<void(WalOp, char*, std::size_t)> &convert   // in: edits one payload in place
+);
+// Copies every complete transaction of a log that is not open, letting
+// convert rewrite each operation's payload (same length) and resealing the
+// checksums; a torn tail is dropped. The copy is fsynced. Used by data
+// format upgrades.
+
+//-----------------------------------------------
+bool checkpointWriteAheadLog();
+// Runs the checkpoint hook and truncates the log.
+
+#endif // WRITE_AHEAD_LOG_H
@@ -0,0 +1,177 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: benchContention.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Contention benchmark for the service layer. Each round runs 1, 2,
+        4, ... N threads against fresh sailings in a scratch directory;
+        every thread books and checks in vehicles on its own sailings and
+        pulls a sailing report page every REPORT_EVERY bookings, so report
+        scans run while other threads are booking. Prints operations per
+        second per round and the speed-up over one thread. Every call's
+        status is checked so a race cannot pass as a speed-up.
+
+        Usage: ./benchContention [max threads, default the core count (min 4)]
+                                 [bookings per thread, default 4000]
+*/
+
+//============================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "ReservationService.h"
+#include "SailingService.h"
+#include "Utilities.h"
+#include "WriteAheadLog.h"
+
+using namespace std;
+
+//============================================
+
+static const size_t VEHICLES_PER_SAILING = 500;  // 500 x 5.5 m fits one 3600 m vessel's two lanes
+static const size_t REPORT_EVERY = 50;           // bookings between report pages
+static const uint32_t REPORT_ROWS = 20;
+
+//-----------------------------------------------
+// helper: sailing and plate of a thread's i-th booking in a round
+static void benchKey(size_t round, size_t thread, size_t i, char (&plate)[11], char (&sailingID)[10])
+{
+    // Sailing IDs must encode (RecordFormat.h): round and thread pick the
+    // terminal letters, the sailing number the day and hour
+    static const char LETTERS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    size_t sailing = i / VEHICLES_PER_SAILING;
+    snprintf(sailingID, sizeof(sailingID), "C%c%c-%02zu-%02zu", LETTERS[round % 52], LETTERS[thread % 52],
+             sailing / 24 % 31 + 1, sailing % 24);
+    snprintf(plate, sizeof(plate), "C%02zu%02zu%05zu", round % 100, thread % 100, i % 100000);
+}
+
+//-----------------------------------------------
+// helper: one thread's share of a round; returns the calls made and
+// counts the calls that did not return the expected status
+static size_t runWorker(size_t round, size_t thread, size_t bookings, atomic<size_t> &failures)
+{
+    size_t calls = 0;
+    for (size_t i = 0; i < bookings; ++i)
+    {
+        ReservationCreateRequest request{};
+        benchKey(round, thread, i, request.licensePlate, request.sailingID);
+        request.registered = 0;
+        request.vehicleLength = 500;  // centimetres
+        request.vehicleHeight = 150;
+        strcpy(request.phone, "604-555-0100");
+        ReservationCreateResponse created;
+        if (ReservationService::create(request, created) != FerryStatus::OK) ++failures;
+        ++calls;
+
+        if (i % REPORT_EVERY == 0)
+        {
+            uint32_t total;
+            vector<SailingRow> rows;
+            if (SailingService::getReport(0, REPORT_ROWS, total, rows) != FerryStatus::OK) ++failures;
+            ++calls;
+        }
+    }
+
+    for (size_t i = 0; i < bookings; ++i)
+    {
+        ReservationKeyRequest request{};
+        benchKey(round, thread, i, request.licensePlate, request.sailingID);
+        CheckInResponse fare;
+        if (ReservationService::checkIn(request, fare) != FerryStatus::OK) ++failures;
+        ++calls;
+    }
+    return calls;
+}
+
+//-----------------------------------------------
+int main(int argc, char *argv[])
+{
+    size_t maxThreads = (argc > 1) ? strtoul(argv[1], nullptr, 10) : max(4u, thread::hardware_concurrency());
+    size_t bookings = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 4000;
+    if (maxThreads == 0 || maxThreads > 99 || bookings == 0 || bookings > 100 * VEHICLES_PER_SAILING)
+    {
+        fprintf(stderr, "Usage: %s [max threads, 1-99] [bookings per thread, 1-%zu]\n",
+                argv[0], 100 * VEHICLES_PER_SAILING);
+        return 1;
+    }
+
+    // Fresh storage, away from the clerk's data files
+    char scratch[] = "/tmp/benchContentionXXXXXX";
+    if (!mkdtemp(scratch) || chdir(scratch) != 0)
+    {
+        perror("scratch directory");
+        return 1;
+    }
+    startup();
+    setGroupCommitPolicy(1024, 50);  // Measure lock contention, not fsync
+
+    Vessel vessel{};
+    strcpy(vessel.name, "Bench");
+    vessel.lowCap = 360000;  // centimetres
+    vessel.highCap = 360000;
+    bool ok = SailingService::createVessel(vessel) == FerryStatus::OK;
+
+    printf("Service contention, %zu bookings + check-ins per thread, a report page every %zu bookings:\n",
+           bookings, REPORT_EVERY);
+    double singleRate = 0.0;
+    size_t round = 0;
+    for (size_t threads = 1; threads <= maxThreads && ok; threads *= 2, ++round)
+    {
+        // Every thread gets its own sailings for the round
+        size_t sailingsPerThread = (bookings + VEHICLES_PER_SAILING - 1) / VEHICLES_PER_SAILING;
+        for (size_t t = 0; t < threads && ok; ++t)
+        {
+            for (size_t s = 0; s < sailingsPerThread && ok; ++s)
+            {
+                SailingCreateRequest request{};
+                char plate[11];
+                strcpy(request.vesselName, "Bench");
+                benchKey(round, t, s * VEHICLES_PER_SAILING, plate, request.sailingID);
+                ok = SailingService::createSailing(request) == FerryStatus::OK;
+            }
+        }
+        if (!ok)
+        {
+            fprintf(stderr, "Could not create the bench sailings\n");
+            break;
+        }
+
+        atomic<size_t> failures{0};
+        atomic<size_t> calls{0};
+        vector<thread> workers;
+        auto start = chrono::steady_clock::now();
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]() { calls += runWorker(round, t, bookings, failures); });
+        }
+        for (thread &worker : workers) worker.join();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        double rate = calls / seconds;
+        if (threads == 1) singleRate = rate;
+        printf("  %2zu thread%s %10.0f ops/s  x%.2f  (%zu calls, %.3f s)\n", threads, threads == 1 ? " " : "s",
+               rate, rate / singleRate, calls.load(), seconds);
+        if (failures > 0)
+        {
+            printf("  %zu calls failed\n", failures.load());
+            ok = false;
+        }
+    }
+
+    shutdown();
+    if (system((string("rm -rf ") + scratch).c_str()) != 0)
+    {
+        fprintf(stderr, "Could not remove %s\n", scratch);
+    }
+    printf(ok ? "All service calls returned the expected status\n" : "FAILED: unexpected status\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: benchKeys.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Microbenchmark for the FixedString key-comparison kernel. For each ID
+        field width used by the record structs it searches an in-memory block
+        of records for keys that are absent (the full-scan worst case) with
+        a strncmp loop, with FixedString::matches per record, and with the
+        batched FixedString::findIn kernel, checking all three agree.
+
+        Usage: ./benchKeys [records, default 1000000]
+*/
+
+//============================================
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "FixedString.h"
+
+using namespace std;
+
+//============================================
+
+// Record with an N-byte key field followed by payload, like the .dat structs
+template <size_t N>
+struct BenchRecord
+{
+    char key[N];
+    char payload[48 - N % 16];
+};
+
+//-----------------------------------------------
+// helper: time fn over `rounds` lookups, printing ns per record compared
+template <typename Fn>
+static long timeIt(const char *label, size_t records, int rounds, Fn fn)
+{
+    auto start = chrono::steady_clock::now();
+    long result = 0;
+    for (int r = 0; r < rounds; ++r)
+    {
+        result += fn(r);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    printf("  %-26s %7.2f ns/record\n", label, seconds * 1e9 / (static_cast<double>(records) * rounds));
+    return result;
+}
+
+//-----------------------------------------------
+template <size_t N>
+static bool runWidth(const char *fieldName, size_t records)
+{
+    // Keys share a long common prefix so strncmp cannot bail out on byte 0
+    vector<BenchRecord<N>> block(records);
+    for (size_t i = 0; i < records; ++i)
+    {
+        memset(&block[i], 0x5A, sizeof(block[i]));  // Junk after the null, as in unzeroed records
+        char digits[32];
+        snprintf(digits, sizeof(digits), "%0*zu", static_cast<int>(N - 1), i);
+        memcpy(block[i].key, digits + strlen(digits) - (N - 1), N - 1);  // Low N-1 digits
+        block[i].key[N - 1] = '\0';
+    }
+
+    const int rounds = 8;
+    vector<FixedString<N>> needles;
+    vector<string> rawKeys;
+    for (int r = 0; r < rounds; ++r)
+    {
+        char key[N + 1];
+        snprintf(key, sizeof(key), "%0*d", static_cast<int>(N - 1), -1 - r);  // Never present
+        rawKeys.push_back(key);
+        needles.emplace_back(key);
+    }
+
+    printf("%s (char[%zu]):\n", fieldName, N);
+    long a = timeIt("strncmp loop", records, rounds, [&](int r) {
+        for (size_t i = 0; i < records; ++i)
+        {
+            if (strncmp(block[i].key, rawKeys[r].c_str(), N) == 0) return static_cast<long>(i);
+        }
+        return -1L;
+    });
+    long b = timeIt("FixedString::matches", records, rounds, [&](int r) {
+        for (size_t i = 0; i < records; ++i)
+        {
+            if (needles[r].matches(block[i].key)) return static_cast<long>(i);
+        }
+        return -1L;
+    });
+    long c = timeIt("FixedString::findIn", records, rounds, [&](int r) {
+        return needles[r].findIn(block[0].key, sizeof(BenchRecord<N>), records);
+    });
+
+    // A present key must be found at the same slot by every method
+    size_t target = records / 2;
+    FixedString<N> present(block[target].key);
+    bool agree = a == b && b == c &&
+                 present.findIn(block[0].key, sizeof(BenchRecord<N>), records) == static_cast<long>(target);
+    if (!agree) printf("  MISMATCH between methods\n");
+    return agree;
+}
+
+//-----------------------------------------------
+int main(int argc, char *argv[])
+{
+    size_t records = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+    if (records < 2) records = 2;
+
+#if defined(__AVX2__)
+    printf("Kernel: AVX2\n");
+#elif defined(__SSE2__)
+    printf("Kernel: SSE2\n");
+#else
+    printf("Kernel: scalar\n");
+#endif
+
+    bool ok = runWidth<10>("Sailing::id", records) &&
+              runWidth<11>("Vehicle::licensePlate", records) &&
+              runWidth<21>("Reservation::id", records) &&
+              runWidth<26>("Vessel::name", records);
+    return ok ? 0 : 1;
+}
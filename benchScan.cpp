@@ -0,0 +1,170 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: benchScan.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Benchmark for the RecordStore block scan engine. Writes millions of
+        reservations twice - as a headerless dump of the in-memory struct
+        (the format v1 file) and through RecordStore as a v2 file of packed
+        records - then counts the reservations of one sailing: with the old
+        per-record iostream loop over the dump, and with
+        RecordStore::scanBlocks comparing the packed sailing code in place.
+        Both passes run against a warm page cache. The store's open() is
+        reported on its own line: the ASMs pay it once at startup, not per
+        scan. The two file sizes are reported last.
+
+        Usage: ./benchScan [millions of records, default 4]
+*/
+
+//============================================
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "LittleEndian.h"
+#include "Reservation.h"
+#include "RecordFormat.h"
+#include "RecordStore.h"
+
+using namespace std;
+
+//============================================
+
+static const char* BENCH_LEGACY_FILE = "bench_reservations_v1.dat";
+static const char* BENCH_FILE = "bench_reservations.dat";
+static const char* TARGET_SAILING = "VIC-15-08";
+
+//-----------------------------------------------
+// helper: flush a new file so no pass pays for writing it back
+static void syncFile(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0)
+    {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+//-----------------------------------------------
+// helper: size of a file in bytes
+static long long fileBytes(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 ? static_cast<long long>(st.st_size) : 0;
+}
+
+//-----------------------------------------------
+// helper: write `total` reservations spread over 100 sailings to both files
+static bool writeBenchFiles(size_t total)
+{
+    remove(BENCH_FILE);
+    RecordStore<Reservation, ReservationCodec> store;
+    if (!store.open(BENCH_FILE)) return false;
+    ofstream out(BENCH_LEGACY_FILE, ios::binary | ios::trunc);
+    vector<Reservation> block(4096);
+    for (size_t written = 0; written < total; )
+    {
+        size_t n = min(block.size(), total - written);
+        for (size_t i = 0; i < n; ++i)
+        {
+            Reservation &r = block[i];
+            memset(&r, 0, sizeof(r));
+            size_t k = written + i;
+            snprintf(r.licensePlate, sizeof(r.licensePlate), "P%08zu", k % 100000000);
+            if (k % 100 == 0) snprintf(r.sailingID, sizeof(r.sailingID), "%s", TARGET_SAILING);
+            else snprintf(r.sailingID, sizeof(r.sailingID), "ABC-%02zu-%02zu", 1 + k % 31, k % 24);
+            snprintf(r.id, sizeof(r.id), "%s%s", r.licensePlate, r.sailingID);
+            r.vehicleLength = 500;
+            r.vehicleHeight = 150;
+            if (!store.append(r)) return false;
+        }
+        out.write(reinterpret_cast<const char*>(block.data()), n * sizeof(Reservation));
+        written += n;
+    }
+    out.close();
+    store.close();
+
+    syncFile(BENCH_LEGACY_FILE);
+    syncFile(BENCH_FILE);
+    return true;
+}
+
+//-----------------------------------------------
+// helper: print one result line
+static void report(const char *label, size_t matches, size_t total, size_t recordSize, double seconds)
+{
+    double mib = total * recordSize / (1024.0 * 1024.0);
+    printf("%-26s %8zu matches  %8.3f s  %9.1f MiB/s  %7.2f Mrec/s\n",
+           label, matches, seconds, mib / seconds, total / seconds / 1e6);
+}
+
+//-----------------------------------------------
+int main(int argc, char *argv[])
+{
+    size_t millions = argc > 1 ? strtoul(argv[1], nullptr, 10) : 4;
+    if (millions == 0) millions = 1;
+    const size_t total = millions * 1000000;
+
+    cout << "Writing " << total << " reservation records to " << BENCH_LEGACY_FILE << " and " << BENCH_FILE
+         << "..." << endl;
+    if (!writeBenchFiles(total))
+    {
+        cerr << "Error: Failed to write " << BENCH_FILE << "." << endl;
+        return 1;
+    }
+
+    // Per-record reads through iostream, as the ASMs did before RecordStore
+    auto start = chrono::steady_clock::now();
+    size_t legacyMatches = 0;
+    {
+        ifstream file(BENCH_LEGACY_FILE, ios::binary);
+        Reservation rec;
+        while (file.read(reinterpret_cast<char*>(&rec), sizeof(Reservation)))
+        {
+            if (strncmp(rec.sailingID, TARGET_SAILING, sizeof(rec.sailingID)) == 0) ++legacyMatches;
+        }
+    }
+    double legacySeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Block scan engine over the mapping, matching the packed sailing code
+    uint32_t targetCode = 0;
+    encodeSailingID(TARGET_SAILING, targetCode);
+    RecordStore<Reservation, ReservationCodec> store;
+    start = chrono::steady_clock::now();
+    store.open(BENCH_FILE);
+    double openSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    size_t blockMatches = 0;
+    store.scanBlocks([&](const ReservationRecord *block, size_t, size_t n) {
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (loadLittleEndian<uint32_t>(block[i].sailing) == targetCode) ++blockMatches;
+        }
+        return true;
+    });
+    double blockSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    store.close();
+
+    report("per-record iostream read", legacyMatches, total, sizeof(Reservation), legacySeconds);
+    report("RecordStore::scanBlocks", blockMatches, total, sizeof(ReservationRecord), blockSeconds);
+    printf("%-26s %8s          %8.3f s\n", "RecordStore::open (once)", "", openSeconds);
+    printf("speedup: %.1fx%s\n", legacySeconds / blockSeconds,
+           legacyMatches == blockMatches ? "" : "  (MISMATCH)");
+    printf("file size: v1 %lld bytes (%zu per record), v2 %lld bytes (%zu per record)\n",
+           fileBytes(BENCH_LEGACY_FILE), sizeof(Reservation), fileBytes(BENCH_FILE), sizeof(ReservationRecord));
+
+    remove(BENCH_LEGACY_FILE);
+    remove(BENCH_FILE);
+    remove((string(BENCH_FILE) + ".free").c_str());
+    return legacyMatches == blockMatches ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: benchService.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Benchmark for the service layer. Runs the reservation hot path
+        (create, check-in, batch check-in, cancel) straight through
+        ReservationService, with no terminal, socket or frame encoding in
+        the way, against fresh storage in a scratch directory. Every call's
+        status is checked so a regression cannot pass as a speed-up.
+
+        Usage: ./benchService [reservations, default 20000]
+*/
+
+//============================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "ReservationService.h"
+#include "SailingService.h"
+#include "Utilities.h"
+#include "WriteAheadLog.h"
+
+using namespace std;
+
+//============================================
+
+static const size_t VEHICLES_PER_SAILING = 500;  // 500 x 5.5 m fits one 3600 m vessel's two lanes
+
+//-----------------------------------------------
+// helper: print a timing line as calls per second
+static void report(const char *label, size_t count, chrono::steady_clock::time_point start)
+{
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    printf("  %-22s %10.0f ops/s  (%zu calls, %.3f s)\n", label, count / seconds, count, seconds);
+}
+
+//-----------------------------------------------
+// helper: time fn over `count` calls; returns false if any call did not
+// return the expected status
+template <typename Fn>
+static bool timeIt(const char *label, size_t count, Fn fn)
+{
+    auto start = chrono::steady_clock::now();
+    size_t failures = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!fn(i)) ++failures;
+    }
+    report(label, count, start);
+    if (failures > 0) printf("  %zu calls failed\n", failures);
+    return failures == 0;
+}
+
+//-----------------------------------------------
+// helper: plate and sailing of the i-th reservation
+static void benchKey(size_t i, char (&plate)[11], char (&sailingID)[10])
+{
+    size_t sailing = i / VEHICLES_PER_SAILING;
+    snprintf(plate, sizeof(plate), "B%08zu", i % 100000000);
+    // Sailing IDs must encode (RecordFormat.h): 744 day/hour slots per terminal
+    size_t terminal = sailing / (31 * 24);
+    snprintf(sailingID, sizeof(sailingID), "B%c%c-%02zu-%02zu", 'A' + static_cast<int>(terminal / 26 % 26),
+             'A' + static_cast<int>(terminal % 26), sailing / 24 % 31 + 1, sailing % 24);
+}
+
+//-----------------------------------------------
+int main(int argc, char *argv[])
+{
+    size_t reservations = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 20000;
+    size_t sailings = (reservations + VEHICLES_PER_SAILING - 1) / VEHICLES_PER_SAILING;
+    if (reservations == 0 || sailings > 10000)
+    {
+        fprintf(stderr, "Usage: %s [reservations, 1-%zu]\n", argv[0], 10000 * VEHICLES_PER_SAILING);
+        return 1;
+    }
+
+    // Fresh storage, away from the clerk's data files
+    char scratch[] = "/tmp/benchServiceXXXXXX";
+    if (!mkdtemp(scratch) || chdir(scratch) != 0)
+    {
+        perror("scratch directory");
+        return 1;
+    }
+    startup();
+    setGroupCommitPolicy(1024, 50);  // Measure the services, not fsync
+
+    Vessel vessel{};
+    strcpy(vessel.name, "Bench");
+    vessel.lowCap = 360000;  // centimetres
+    vessel.highCap = 360000;
+    bool ok = SailingService::createVessel(vessel) == FerryStatus::OK;
+    for (size_t s = 0; s < sailings && ok; ++s)
+    {
+        SailingCreateRequest request{};
+        char plate[11];
+        strcpy(request.vesselName, "Bench");
+        benchKey(s * VEHICLES_PER_SAILING, plate, request.sailingID);
+        ok = SailingService::createSailing(request) == FerryStatus::OK;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "Could not create the bench sailings\n");
+        shutdown();
+        return 1;
+    }
+
+    printf("ReservationService, %zu reservations on %zu sailings:\n", reservations, sailings);
+
+    ok = timeIt("create", reservations, [](size_t i) {
+        ReservationCreateRequest request{};
+        benchKey(i, request.licensePlate, request.sailingID);
+        request.registered = 0;
+        request.vehicleLength = 500;  // centimetres
+        request.vehicleHeight = 150;
+        strcpy(request.phone, "604-555-0100");
+        ReservationCreateResponse result;
+        return ReservationService::create(request, result) == FerryStatus::OK;
+    }) && ok;
+
+    // Check in the first half one by one, the second half one sailing at a time
+    size_t half = reservations / 2;
+    ok = timeIt("checkIn", half, [](size_t i) {
+        ReservationKeyRequest request{};
+        benchKey(i, request.licensePlate, request.sailingID);
+        CheckInResponse result;
+        return ReservationService::checkIn(request, result) == FerryStatus::OK;
+    }) && ok;
+
+    auto start = chrono::steady_clock::now();
+    for (size_t first = half; first < reservations; )
+    {
+        // Plates first..last-1 all belong to one sailing
+        size_t last = min(reservations, (first / VEHICLES_PER_SAILING + 1) * VEHICLES_PER_SAILING);
+        char plates[VEHICLES_PER_SAILING][11];
+        const char *platePointers[VEHICLES_PER_SAILING];
+        char sailingID[10];
+        for (size_t i = first; i < last; ++i)
+        {
+            benchKey(i, plates[i - first], sailingID);
+            platePointers[i - first] = plates[i - first];
+        }
+
+        vector<BatchCheckInResult> results;
+        if (ReservationService::checkInBatch(sailingID, platePointers, last - first, results) != FerryStatus::OK)
+        {
+            ok = false;
+        }
+        for (const BatchCheckInResult &result : results)
+        {
+            if (result.status != static_cast<uint16_t>(FerryStatus::OK)) ok = false;
+        }
+        first = last;
+    }
+    report("checkInBatch (plates)", reservations - half, start);
+
+    // Every reservation is onboard now, so each cancel is refused
+    ok = timeIt("cancel (refused)", reservations, [](size_t i) {
+        ReservationKeyRequest request{};
+        benchKey(i, request.licensePlate, request.sailingID);
+        return ReservationService::cancel(request) == FerryStatus::ALREADY_ONBOARD;
+    }) && ok;
+
+    shutdown();
+    if (system((string("rm -rf ") + scratch).c_str()) != 0)
+    {
+        fprintf(stderr, "Could not remove %s\n", scratch);
+    }
+    printf(ok ? "All service calls returned the expected status\n" : "FAILED: unexpected status\n");
+    return ok ? 0 : 1;
+}
@@ -6,10 +6,26 @@
     Revision 1.0: 2025/07/07 - Original by Brandon Landa-Ahn
     Purpose: 
         This module is the main module for the ferry reservation system. 
+        Usage:
+            myprogram                    menus against the local data files
+            myprogram --server [socket]  own the data files and serve clerks
+            myprogram --client [socket]  menus against a running server
+            myprogram --batch FILE [socket]
+                                         run the commands in FILE ("-" for
+                                         standard input) without prompts,
+                                         locally or against a running server
+        The socket defaults to ferry.sock in the working directory.
 */
 
 //============================================
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
 #include "Utilities.h"
+#include "BatchCommandProcessor.h"
+#include "FerryClient.h"
+#include "FerryServer.h"
 #include "MenuUI.h"
 #include "ReservationASM.h"
 #include "ReservationCommandProcessor.h"
@@ -18,9 +34,91 @@
 #include "VehicleASM.h"
 #include "VesselASM.h"
 #include "VesselCommandProcessor.h"
+#include "WriteAheadLog.h"
 
-int main() 
+//-----------------------------------------------
+// helper: --batch FILE [socket]; results on stdout, totals on stderr
+static int runBatchMode(const std::string &path, const std::string &socketPath)
 {
+    std::ifstream file;
+    if (path != "-")
+    {
+        file.open(path);
+        if (!file.is_open())
+        {
+            std::cerr << "Error: Cannot open command file " << path << "." << std::endl;
+            return 1;
+        }
+    }
+    std::istream &commands = path == "-" ? std::cin : file;
+
+    if (!socketPath.empty())
+    {
+        if (!connectFerryServer(socketPath))
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        startup();
+        setGroupCommitPolicy(BATCH_GROUP_TXNS, BATCH_GROUP_MS);  // A batch can be re-run; trade fsyncs for throughput
+    }
+
+    std::ios::sync_with_stdio(false);  // No prompts to interleave with; buffer the results
+    auto start = std::chrono::steady_clock::now();
+    BatchSummary summary = runBatchCommands(commands, std::cout);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (!socketPath.empty())
+    {
+        disconnectFerryServer();
+    }
+    else
+    {
+        shutdown();
+    }
+
+    std::cerr << "Batch: " << summary.commands << " commands, " << summary.succeeded << " OK, "
+              << summary.failed << " failed in " << seconds << " s" << std::endl;
+    return 0;
+}
+
+int main(int argc, char *argv[]) 
+{
+    std::string mode = argc > 1 ? argv[1] : "";
+    std::string socketPath = argc > 2 ? argv[2] : FERRY_DEFAULT_SOCKET;
+
+    if (mode == "--server")  // Serve clerk clients until SIGINT/SIGTERM
+    {
+        startup();
+        bool served = runFerryServer(socketPath, FERRY_DEFAULT_WORKERS);
+        shutdown();
+        return served ? 0 : 1;
+    }
+
+    if (mode == "--client")  // Menus only; the server owns the data files
+    {
+        if (!connectFerryServer(socketPath))
+        {
+            return 1;
+        }
+        runMainMenu();
+        disconnectFerryServer();
+        return 0;
+    }
+
+    if (mode == "--batch" && argc > 2)  // Scripted commands, no menus
+    {
+        return runBatchMode(argv[2], argc > 3 ? argv[3] : "");
+    }
+
+    if (!mode.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " [--server [socket] | --client [socket] | --batch FILE [socket]]" << std::endl;
+        return 1;
+    }
+
     startup();
 
     runMainMenu();
@@ -0,0 +1,63 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+/*
+    Module: migrate.cpp
+    Revision History:
+    Revision 1.0: 2026-10-16 - Created by Team
+    Purpose:
+        Converts the data files in a directory to the current format
+        (v2 record files: header + packed records, reservations in one
+        file per sailing) in one streaming pass per file, and reports
+        what was rewritten. myprogram performs the
+        same upgrade at startup; this tool lets an operator run it ahead
+        of time, or on a copy of the data, and see the size change.
+        Records the packed format cannot hold (e.g. a sailing ID such as
+        V1C-45-30 from before the create screen checked IDs) are listed
+        on stderr and moved to <file>.rejected; the rest are converted.
+
+        Usage: ./migrate [data directory, default .]
+*/
+
+//============================================
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <vector>
+#include <unistd.h>
+#include "DataFormat.h"
+
+using namespace std;
+
+//============================================
+int main(int argc, char *argv[])
+{
+    const char *directory = argc > 1 ? argv[1] : ".";
+    if (chdir(directory) != 0)
+    {
+        fprintf(stderr, "Error: Cannot enter %s: %s.\n", directory, strerror(errno));
+        return 1;
+    }
+
+    vector<DataFileUpgrade> upgraded;
+    if (!upgradeDataFiles(&upgraded)) return 1;
+    if (upgraded.empty())
+    {
+        printf("%s: already at data format %u\n", directory, static_cast<unsigned>(DATA_FORMAT_CURRENT));
+        return 0;
+    }
+
+    printf("%s: converted to data format %u\n", directory, static_cast<unsigned>(DATA_FORMAT_CURRENT));
+    // Loop goal: one line per rewritten file
+    for (const DataFileUpgrade &file : upgraded)
+    {
+        printf("  %-18s %8llu records  %10llu -> %10llu bytes\n", file.file.c_str(),
+               static_cast<unsigned long long>(file.records), static_cast<unsigned long long>(file.bytesBefore),
+               static_cast<unsigned long long>(file.bytesAfter));
+        if (file.rejected > 0)
+        {
+            printf("  %-18s %8llu records the packed format cannot hold, kept in %s.rejected\n", "",
+                   static_cast<unsigned long long>(file.rejected), file.file.c_str());
+        }
+    }
+    return 0;
+}
@@ -7,15 +7,54 @@
     Purpose:
         This module tests the ReservationASM functions, specifically addReservation and getReservationByID.
         It creates sample reservations, adds them to storage, retrieves them by ID, and verifies the results.
+        It also checks that record files the store refuses to open are left unchanged,
+        and that deleting one of two sailings with the same ID keeps the other usable.
+        A page of sailings is checked to come newest first, without deleted sailings.
+        The block scan engine is checked to visit every live record once, in slot order.
+        FixedString key matching is checked against strncmp over short and long fields.
+        A sailing's report aggregates are checked to follow every reservation change.
+        Record handles are checked to reach their record until it is deleted or compacted.
+        Batch lookups are checked to answer each key in order, as single lookups do.
+        Lookups running alongside bookings, deletes and compaction are checked to lose nothing.
+        Lane space taken by competing threads is checked never to oversell a sailing.
+        Packed reservation keys are checked to round-trip and to order as the IDs do.
+        A single reservations.dat is checked to split into one file per sailing on upgrade,
+        and a batch check-in is checked to succeed when its sailing's file is compacted under it.
+        Sailing IDs the packed format cannot hold are checked to be set aside, not to stop the upgrade.
+        A prepared sailing's check-ins are checked to reach its file in batches and on departure.
+        Every test runs in a fresh scratch directory under /tmp, removed at exit, so the
+        clerk's data files in the working directory are never touched.
         Compilation: g++ testFileOps.cpp ReservationASM.cpp -o testFileOps.exe
 */
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <thread>
 #include <vector>
 #include <cstring>
+#include <string>
+#include <unistd.h>
+#include "BackgroundTasks.h"
+#include "DataFormat.h"
+#include "FixedString.h"
+#include "RecordFormat.h"
+#include "RecordStore.h"
+#include "ReservationKey.h"
+#include "ReservationService.h"
 #include "ReservationASM.h"
 #include "Reservation.h"
+#include "SailingASM.h"
+#include "Units.h"
+#include "Utilities.h"
+#include "Vehicle.h"
+#include "Vessel.h"
+#include "VesselASM.h"
 
 using namespace std;
 
@@ -26,8 +65,8 @@ void printReservation(const Reservation& r) {
     cout << "=== Reservation ===" << endl;
     cout << "License Plate:     " << r.licensePlate << endl;
     cout << "Sailing ID:        " << r.sailingID << endl;
-    cout << "Vehicle Length:    " << r.vehicleLength << " m" << endl;
-    cout << "Vehicle Height:    " << r.vehicleHeight << " m" << endl;
+    cout << "Vehicle Length:    " << toMetres(r.vehicleLength) << " m" << endl;
+    cout << "Vehicle Height:    " << toMetres(r.vehicleHeight) << " m" << endl;
     cout << "Phone:             " << r.phone << endl;
     cout << "Onboard:           " << (r.onboard ? "Yes" : "No") << endl;
     cout << "Expected Return:   "
@@ -36,11 +75,885 @@ void printReservation(const Reservation& r) {
          << r.expectedReturnDate.day << endl;
 }
 
+//------------------------------------------------------------------------
+// Function: readFileBytes
+// Purpose: Returns the whole contents of a file (empty if it is missing)
+static vector<char> readFileBytes(const char* path) {
+    ifstream in(path, ios::binary);
+    return vector<char>((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+}
+
+//------------------------------------------------------------------------
+// Function: testRejectedFilesUnchanged
+// Purpose: Checks that a record file RecordStore refuses to open (not v2,
+//          failed checksum, shorter than its header) is left byte-for-byte
+//          as it was, and is still refused on a second open
+static bool testRejectedFilesUnchanged() {
+    const char* path = "testreject.dat";
+    bool ok = true;
+    auto expectRejected = [&](const char* what) {
+        vector<char> before = readFileBytes(path);
+        for (int attempt = 0; attempt < 2; ++attempt) {
+            RecordStore<Vehicle, VehicleCodec> store;
+            if (store.open(path)) {
+                cout << "FAIL: " << what << " file was opened." << endl;
+                ok = false;
+                return;
+            }
+        }
+        if (readFileBytes(path) != before) {
+            cout << "FAIL: " << what << " file was changed by a rejected open." << endl;
+            ok = false;
+        }
+    };
+
+    // A legacy (pre-v2) file: no record header at all
+    {
+        ofstream out(path, ios::binary | ios::trunc);
+        for (int i = 0; i < 1000; ++i) out.put(static_cast<char>('A' + i % 26));
+    }
+    expectRejected("legacy");
+
+    // A clean v2 file with one corrupted record byte
+    remove(path);
+    {
+        RecordStore<Vehicle, VehicleCodec> store;
+        store.open(path);
+        for (int i = 0; i < 3; ++i) {
+            Vehicle v = {};
+            snprintf(v.licensePlate, sizeof(v.licensePlate), "REJ%03d", i);
+            store.append(v);
+        }
+    }
+    vector<char> clean = readFileBytes(path);
+    {
+        fstream io(path, ios::binary | ios::in | ios::out);
+        io.seekp(RECORD_FILE_HEADER_BYTES + 2);
+        io.put(static_cast<char>(clean[RECORD_FILE_HEADER_BYTES + 2] ^ 0x5A));
+    }
+    expectRejected("corrupt");
+
+    // The same clean file cut short by one record
+    {
+        ofstream out(path, ios::binary | ios::trunc);
+        out.write(clean.data(), static_cast<streamsize>(clean.size() - sizeof(VehicleRecord)));
+    }
+    expectRejected("short");
+
+    remove(path);
+    remove((string(path) + ".free").c_str());
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testDuplicateSailingDelete
+// Purpose: Checks that deleting one of two sailings stored under the same
+//          ID leaves the other reachable, with a working capacity counter
+static bool testDuplicateSailingDelete() {
+    remove("sailings.dat");
+    initializeSailingStorage();
+
+    Sailing copy = {"DUP-01-01", "Duplicate", 1000, 1000, 0};
+    bool ok = addSailing(copy) && addSailing(copy) && deleteSailing("DUP-01-01");
+
+    Lane lane;
+    ok = ok && getSailingByID("DUP-01-01").has_value();
+    ok = ok && reserveLaneSpace("DUP-01-01", 300, false, lane) && lane == Lane::LOW;
+    ok = ok && getRemainingCapacity("DUP-01-01") == make_pair(int32_t{700}, int32_t{1000});
+    ok = ok && releaseLaneSpace("DUP-01-01", lane, 300);
+    ok = ok && deleteSailing("DUP-01-01") && !getSailingByID("DUP-01-01").has_value();
+
+    shutdownSailingStorage();
+    remove("sailings.dat");
+    remove("sailings.dat.free");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testSailingPages
+// Purpose: Checks that a page of sailings comes newest first, skips
+//          deleted sailings and stops at the end of the table
+static bool testSailingPages() {
+    remove("sailings.dat");
+    initializeSailingStorage();
+
+    bool ok = true;
+    for (int hour = 0; ok && hour < 6; ++hour) {
+        Sailing s = {"", "Pages", 1000, 1000, 0};
+        snprintf(s.id, sizeof(s.id), "PGA-01-%02d", hour);
+        ok = addSailing(s);
+    }
+    ok = ok && deleteSailing("PGA-01-02");
+
+    auto page = [](size_t skip, size_t maxCount, size_t& total) {
+        string ids;
+        for (const Sailing& s : getSailingsNewestFirst(skip, maxCount, total)) ids += string(s.id) + " ";
+        return ids;
+    };
+    size_t total = 0;
+    ok = ok && page(1, 2, total) == "PGA-01-04 PGA-01-03 " && total == 5;
+    ok = ok && page(3, 10, total) == "PGA-01-01 PGA-01-00 " && total == 5;
+    ok = ok && page(9, 10, total).empty() && total == 5;
+
+    shutdownSailingStorage();
+    remove("sailings.dat");
+    remove("sailings.dat.free");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testBlockScan
+// Purpose: Checks that the block scan engine visits every live record of a
+//          file spanning several blocks exactly once, in slot order and
+//          skipping tombstones, and that a visitor can stop it early
+static bool testBlockScan() {
+    const char* path = "testscan.dat";
+    remove(path);
+    remove((string(path) + ".free").c_str());
+    RecordStore<Vehicle, VehicleCodec> store;
+    bool ok = store.open(path);
+
+    // Enough records for several 64 KiB blocks; every seventh is erased
+    const size_t total = 3 * (RECORD_STORE_SCAN_BLOCK_BYTES / sizeof(VehicleRecord)) + 5;
+    for (size_t i = 0; ok && i < total; ++i) {
+        Vehicle v = {};
+        snprintf(v.licensePlate, sizeof(v.licensePlate), "SCAN%05zu", i);
+        v.vehicleLength = static_cast<int32_t>(i);
+        ok = store.append(v);
+    }
+    for (size_t i = 0; ok && i < total; i += 7) ok = store.erase(i);
+
+    size_t visited = 0;
+    long lastSlot = -1;
+    store.forEachLive([&](size_t slot, const Vehicle& v) {
+        if (static_cast<long>(slot) <= lastSlot || slot % 7 == 0 || v.vehicleLength != static_cast<int32_t>(slot)) ok = false;
+        lastSlot = static_cast<long>(slot);
+        ++visited;
+    });
+    ok = ok && visited == store.liveCount() && visited == total - (total + 6) / 7;
+
+    // findIf reaches the last block and does not match a tombstone
+    ok = ok && store.findIf([](const Vehicle& v) { return strcmp(v.licensePlate, "SCAN06556") == 0; }) == 6556;
+    ok = ok && store.findIf([](const Vehicle& v) { return strcmp(v.licensePlate, "SCAN00007") == 0; }) == -1;
+
+    // A visitor that returns false ends the scan after its first block
+    int blocks = 0;
+    bool completed = store.scanBlocks([&](const VehicleRecord*, size_t firstSlot, size_t) {
+        ok = ok && firstSlot == 0;
+        ++blocks;
+        return false;
+    });
+    ok = ok && !completed && blocks == 1;
+
+    store.close();
+    remove(path);
+    remove((string(path) + ".free").c_str());
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: checkKeyKernel
+// Purpose: Compares FixedString<N>::matches and findIn with strncmp over
+//          pseudo-random fields and keys drawn from a tiny alphabet (so many
+//          match), including full-width keys and bytes after a field's null
+template <size_t N>
+static bool checkKeyKernel(unsigned seed) {
+    const char alphabet[] = {'A', 'B', '\0'};
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return (seed >> 16) % 3; };
+    bool ok = true;
+    for (int round = 0; round < 2000; ++round) {
+        char fields[7][N];
+        for (auto& field : fields) {
+            for (size_t i = 0; i < N; ++i) field[i] = alphabet[next()];
+        }
+        char key[N + 1] = {};
+        for (size_t i = 0; i < N; ++i) key[i] = alphabet[next()];
+        FixedString<N> fixedKey(key);
+
+        long expected = -1;
+        for (int f = 0; f < 7; ++f) {
+            bool same = strncmp(fields[f], key, N) == 0;
+            if (fixedKey.matches(fields[f]) != same) ok = false;
+            if (same && expected < 0) expected = f;
+        }
+        if (fixedKey.findIn(fields[0], N, 7) != expected) ok = false;
+    }
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testFixedStringMatch
+// Purpose: Checks the FixedString key kernels for plate-width (word
+//          compare) and vessel-name-width (vector compare) fields
+static bool testFixedStringMatch() {
+    bool ok = checkKeyKernel<sizeof(VehicleRecord::licensePlate)>(1) &&
+              checkKeyKernel<sizeof(Vessel::name)>(2) &&
+              checkKeyKernel<sizeof(Sailing::id)>(3);
+
+    // Only the first N characters of a key count, for equality and hashing
+    FixedString<10> longKey("ABCDEFGHIJK");
+    FixedString<10> fullKey("ABCDEFGHIJ");
+    ok = ok && longKey == fullKey && longKey.hash() == fullKey.hash() && fullKey.size() == 10;
+    ok = ok && FixedString<10>("ABC") != FixedString<10>("ABD");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: makeTestReservation
+// Purpose: Builds a reservation with its ID filled in from plate and sailing
+static Reservation makeTestReservation(const char* plate, const char* sailingID, int32_t length, Lane lane) {
+    Reservation r = {};
+    strcpy(r.licensePlate, plate);
+    strcpy(r.sailingID, sailingID);
+    makeReservationID(plate, sailingID, r.id);
+    r.vehicleLength = length;
+    r.vehicleHeight = lane == Lane::LOW ? 150 : 300;
+    strcpy(r.phone, "604-555-0100");
+    r.reservedLane = lane;
+    return r;
+}
+
+//------------------------------------------------------------------------
+// Function: testSailingAggregates
+// Purpose: Checks that a sailing's report aggregates follow reservation
+//          adds, replacements and deletes, survive a restart of the
+//          reservation storage, and clear when the sailing's file is dropped
+static bool testSailingAggregates() {
+    remove("sailings.dat");
+    remove("vessels.dat");
+    remove("reservations.dir");
+    initializeVesselStorage();
+    initializeSailingStorage();
+    initializeReservationStorage();
+
+    Vessel vessel = {"Aggregate", 4000, 2000};
+    Sailing sailing = {"AGG-02-10", "Aggregate", 3000, 1500, 0};
+    bool ok = addVessel(vessel) && addSailing(sailing);
+    ok = ok && addReservation(makeTestReservation("AGG1", "AGG-02-10", 400, Lane::LOW));
+    ok = ok && addReservation(makeTestReservation("AGG2", "AGG-02-10", 600, Lane::HIGH));
+    ok = ok && addReservation(makeTestReservation("AGG3", "AGG-02-10", 300, Lane::LOW));
+
+    auto expect = [&](int count, int64_t low, int64_t high) {
+        SailingAggregate agg = getSailingAggregate(sailing);
+        float factor = static_cast<float>(100.0 * (6000 - (4500 - 50 * count)) / 6000);
+        return agg.vehicleCount == count && agg.lowLaneUsed == low && agg.highLaneUsed == high &&
+               agg.vesselCapacity == 6000 && agg.capacityFactor == factor;
+    };
+    ok = ok && expect(3, 450 + 350, 650);
+
+    // Replacing a reservation swaps its share; deleting one removes it
+    ok = ok && addReservation(makeTestReservation("AGG3", "AGG-02-10", 500, Lane::HIGH));
+    ok = ok && expect(3, 450, 650 + 550);
+    char id[21];
+    makeReservationID("AGG2", "AGG-02-10", id);
+    ok = ok && deleteReservation(id) && expect(2, 450, 550);
+
+    // Rebuilt from the files when the reservation storage reopens
+    shutdownReservationStorage();
+    initializeReservationStorage();
+    ok = ok && expect(2, 450, 550);
+
+    ok = ok && deleteReservationsBySailingID("AGG-02-10") && expect(0, 0, 0);
+
+    shutdownReservationStorage();
+    shutdownSailingStorage();
+    shutdownVesselStorage();
+    remove("reservations.dir");
+    remove("sailings.dat");
+    remove("sailings.dat.free");
+    remove("vessels.dat");
+    remove("vessels.dat.free");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testRecordHandles
+// Purpose: Checks that a handle from a lookup reads, updates and deletes its
+//          record without a search, stops resolving once the record is
+//          deleted or moved by a compaction, and that a fresh lookup after
+//          the compaction gives a working handle to the same record
+static bool testRecordHandles() {
+    remove("reservations.dir");
+    initializeReservationStorage();
+
+    char ids[100][21];
+    bool ok = true;
+    for (int i = 0; ok && i < 100; ++i) {
+        char plate[11];
+        snprintf(plate, sizeof(plate), "HDL%03d", i);
+        Reservation r = makeTestReservation(plate, "HDL-03-12", 400, Lane::LOW);
+        strcpy(ids[i], r.id);
+        ok = addReservation(r);
+    }
+
+    // Read, update and check in through the handle
+    RecordHandle handle;
+    optional<Reservation> found = getReservationByID(ids[99], handle);
+    ok = ok && found && getReservation(handle) && strcmp(getReservation(handle)->licensePlate, "HDL099") == 0;
+    if (found) {
+        strcpy(found->phone, "250-555-0199");
+        ok = ok && updateReservation(handle, *found) && setOnboardStatus(handle, true);
+        Reservation other = *found;
+        strcpy(other.licensePlate, "HDL098");
+        strcpy(other.id, ids[98]);
+        ok = ok && !updateReservation(handle, other);  // A handle cannot change its record's ID
+    }
+
+    // A deleted record's handle stops resolving, even once its slot is reused
+    RecordHandle deletedHandle;
+    ok = ok && getReservationByID(ids[0], deletedHandle) && deleteReservation(deletedHandle);
+    ok = ok && !getReservation(deletedHandle) && !deleteReservation(deletedHandle) && !getReservationByID(ids[0]);
+    ok = ok && addReservation(makeTestReservation("HDLNEW", "HDL-03-12", 400, Lane::LOW));
+    ok = ok && !getReservation(deletedHandle);
+
+    // Enough tombstones to compact the sailing's file; wait for the background task
+    for (int i = 1; ok && i < 80; ++i) ok = deleteReservation(string(ids[i]));
+    stopBackgroundTasks();
+    ok = ok && !getReservation(handle) && !setOnboardStatus(handle, false) && !deleteReservation(handle);
+
+    RecordHandle renewed;
+    found = getReservationByID(ids[99], renewed);
+    ok = ok && found && found->onboard && strcmp(found->phone, "250-555-0199") == 0;
+    ok = ok && renewed.slot < handle.slot && getReservation(renewed) && setOnboardStatus(renewed, false);
+    ok = ok && getReservationByID(ids[99]) && !getReservationByID(ids[99])->onboard;
+
+    ok = ok && deleteReservationsBySailingID("HDL-03-12");
+    shutdownReservationStorage();
+    remove("reservations.dir");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: sameHandle
+// Purpose: True if two handles name the same slot generation of one file
+static bool sameHandle(const RecordHandle& a, const RecordHandle& b) {
+    return a.slot == b.slot && a.generation == b.generation && a.partition == b.partition;
+}
+
+//------------------------------------------------------------------------
+// Function: testBatchLookup
+// Purpose: Checks that a batch lookup answers each key in its position, as
+//          one-at-a-time lookups would, with matching handles, for found,
+//          missing, invalid and repeated keys, on both the index-probe path
+//          (few keys) and the shared file pass (many keys)
+static bool testBatchLookup() {
+    remove("reservations.dir");
+    initializeReservationStorage();
+
+    bool ok = true;
+    vector<string> ids;
+    for (int i = 0; ok && i < 300; ++i) {
+        char plate[11];
+        snprintf(plate, sizeof(plate), "BAT%03d", i);
+        Reservation r = makeTestReservation(plate, i < 200 ? "BAT-04-08" : "BAT-05-09", 400, Lane::LOW);
+        ids.push_back(r.id);
+        ok = addReservation(r);
+    }
+
+    // Compares every answer with a single lookup of the same ID
+    auto matchesSingle = [&](const vector<string>& batch) {
+        vector<const char*> batchIDs;
+        for (const string& id : batch) batchIDs.push_back(id.c_str());
+        vector<RecordHandle> handles;
+        vector<optional<Reservation>> found = getReservationsByIDs(batchIDs.data(), batchIDs.size(), &handles);
+        bool same = found.size() == batch.size() && handles.size() == batch.size();
+        for (size_t i = 0; same && i < batch.size(); ++i) {
+            RecordHandle single;
+            optional<Reservation> expected = getReservationByID(batch[i].c_str(), single);
+            same = found[i].has_value() == expected.has_value();
+            if (same && expected) {
+                same = strcmp(found[i]->id, expected->id) == 0 && sameHandle(handles[i], single) &&
+                       getReservation(handles[i]) && strcmp(getReservation(handles[i])->id, batch[i].c_str()) == 0;
+            }
+        }
+        return same;
+    };
+    char missing[21];
+    char wrongSailing[21];
+    makeReservationID("BAT999", "BAT-04-08", missing);
+    makeReservationID("BAT250", "BAT-04-08", wrongSailing);  // Booked, but on the other sailing
+    vector<string> mixed = {ids[150], missing, "NOT AN ID", ids[250], ids[150], wrongSailing, ids[0]};
+
+    ok = ok && matchesSingle({ids[42]});   // Index probe
+    ok = ok && matchesSingle(mixed);      // Shared pass over both files
+    ok = ok && matchesSingle(ids);
+
+    // Invalid keys are not found; the key form gives the same answers
+    vector<ReservationKey> keys(3);
+    ok = ok && parseReservationID(ids[150].c_str(), keys[0]) && parseReservationID(ids[250].c_str(), keys[2]);
+    vector<optional<Reservation>> byKey = getReservationsByKeys(keys.data(), keys.size());
+    ok = ok && byKey.size() == 3 && byKey[0] && strcmp(byKey[0]->licensePlate, "BAT150") == 0 &&
+         !byKey[1] && byKey[2] && strcmp(byKey[2]->licensePlate, "BAT250") == 0;
+
+    ok = ok && deleteReservationsBySailingID("BAT-04-08") && deleteReservationsBySailingID("BAT-05-09");
+    shutdownReservationStorage();
+    remove("reservations.dir");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testConcurrentReaders
+// Purpose: Checks that lookups running alongside bookings and deletes on the
+//          same sailing (and the compactions those deletes trigger) always
+//          find the records that are not being changed, and that every
+//          writer's changes are all there afterwards
+static bool testConcurrentReaders() {
+    remove("reservations.dir");
+    initializeReservationStorage();
+
+    bool ok = true;
+    vector<Reservation> steady;  // Never changed while the threads run
+    for (int i = 0; ok && i < 200; ++i) {
+        char plate[11];
+        snprintf(plate, sizeof(plate), "RDR%03d", i);
+        steady.push_back(makeTestReservation(plate, "MIX-06-07", 400, Lane::LOW));
+        ok = addReservation(steady.back());
+    }
+
+    // Writers book 300 vehicles each and cancel two in three of them
+    atomic<bool> writing(true);
+    atomic<int> failures(0);
+    vector<thread> writers;
+    for (int w = 0; w < 4; ++w) {
+        writers.emplace_back([w, &failures]() {
+            for (int i = 0; i < 300; ++i) {
+                char plate[11];
+                snprintf(plate, sizeof(plate), "WR%d%03d", w, i);
+                Reservation r = makeTestReservation(plate, "MIX-06-07", 500, Lane::HIGH);
+                if (!addReservation(r)) ++failures;
+                if (i % 3 != 0 && !deleteReservation(string(r.id))) ++failures;
+            }
+        });
+    }
+    vector<thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([t, &steady, &writing, &failures]() {
+            for (int pass = 0; pass < 50 && writing; ++pass) {
+                for (size_t i = t; i < steady.size(); i += 4) {
+                    optional<Reservation> r = getReservationByID(steady[i].id);
+                    if (!r || strcmp(r->licensePlate, steady[i].licensePlate) != 0 || r->vehicleLength != 400) ++failures;
+                }
+            }
+        });
+    }
+    for (thread& writer : writers) writer.join();
+    writing = false;
+    for (thread& reader : readers) reader.join();
+    stopBackgroundTasks();
+
+    ok = ok && failures == 0 && countReservationsBySailing("MIX-06-07") == 200 + 4 * 100;
+    for (int w = 0; ok && w < 4; ++w) {
+        for (int i = 0; ok && i < 300; ++i) {
+            char plate[11];
+            char id[21];
+            snprintf(plate, sizeof(plate), "WR%d%03d", w, i);
+            makeReservationID(plate, "MIX-06-07", id);
+            ok = getReservationByID(id).has_value() == (i % 3 == 0);
+        }
+    }
+
+    ok = ok && deleteReservationsBySailingID("MIX-06-07");
+    shutdownReservationStorage();
+    remove("reservations.dir");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testContendedCapacity
+// Purpose: Checks that threads racing to take lane space on one sailing
+//          never oversell a lane, that the space and reservation count left
+//          are exact, and that giving it all back concurrently restores it
+static bool testContendedCapacity() {
+    remove("sailings.dat");
+    initializeSailingStorage();
+    Sailing sailing = {"CAS-07-11", "Contention", 10000, 5000, 0};
+    bool ok = addSailing(sailing);
+
+    // Half the threads book 650 cm low-lane-first vehicles, half 450 cm
+    // high-lane-only ones, each until its request no longer fits
+    struct Taken { Lane lane; int32_t space; };
+    vector<vector<Taken>> taken(8);
+    vector<thread> bookers;
+    for (int t = 0; t < 8; ++t) {
+        bookers.emplace_back([t, &taken]() {
+            const bool tall = t % 2 == 1;
+            const int32_t space = tall ? 450 : 650;
+            Lane lane;
+            while (reserveLaneSpace("CAS-07-11", space, tall, lane)) taken[t].push_back({lane, space});
+        });
+    }
+    for (thread& booker : bookers) booker.join();
+
+    int64_t lowUsed = 0;
+    int64_t highUsed = 0;
+    int bookings = 0;
+    for (const auto& list : taken) {
+        for (const Taken& booking : list) {
+            (booking.lane == Lane::LOW ? lowUsed : highUsed) += booking.space;
+            ++bookings;
+        }
+    }
+    pair<int32_t, int32_t> left = getRemainingCapacity("CAS-07-11");
+    ok = ok && lowUsed <= 10000 && highUsed <= 5000;
+    ok = ok && left.first == 10000 - lowUsed && left.second == 5000 - highUsed;
+    ok = ok && left.first < 650 && left.second < 450;  // Every thread stopped only when it no longer fit
+    ok = ok && getSailingByID("CAS-07-11") && getSailingByID("CAS-07-11")->reservationsCount == bookings;
+
+    atomic<bool> released(true);
+    vector<thread> releasers;
+    for (int t = 0; t < 8; ++t) {
+        releasers.emplace_back([t, &taken, &released]() {
+            for (const Taken& booking : taken[t]) {
+                if (!releaseLaneSpace("CAS-07-11", booking.lane, booking.space)) released = false;
+            }
+        });
+    }
+    for (thread& releaser : releasers) releaser.join();
+    ok = ok && released && getRemainingCapacity("CAS-07-11") == make_pair(int32_t{10000}, int32_t{5000});
+    ok = ok && getSailingByID("CAS-07-11") && getSailingByID("CAS-07-11")->reservationsCount == 0;
+
+    shutdownSailingStorage();
+    remove("sailings.dat");
+    remove("sailings.dat.free");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testPackedKeys
+// Purpose: Checks that plates, sailing IDs and reservation IDs survive their
+//          packed forms unchanged, that packed plates order as strcmp
+//          orders the plates, that text with no packed form is refused, and
+//          that a reservation record decodes to what was encoded
+static bool testPackedKeys() {
+    bool ok = true;
+
+    // Plate + sailing to key, to ID text (as makeReservationID writes it) and back
+    const char* plates[] = {"-", "0", "9", "A", "A0", "AB", "ABC-123", "B", "Z", "ZZZZZZZZZZ", "a", "abc-123", "z"};
+    const char* sailings[] = {"AAA-01-00", "VIC-15-08", "zzz-31-23"};
+    for (const char* plate : plates) {
+        for (const char* sailingID : sailings) {
+            ReservationKey key;
+            ReservationKey parsed;
+            ReservationKey unpadded;
+            char id[21];
+            char expected[21];
+            ok = ok && makeReservationKey(plate, sailingID, key) && key.isValid();
+            formatReservationID(key, id);
+            makeReservationID(plate, sailingID, expected);
+            ok = ok && strcmp(id, expected) == 0;
+            ok = ok && parseReservationID(id, parsed) && parsed == key && parsed.hash() == key.hash();
+            ok = ok && parseReservationID((string(plate) + sailingID).c_str(), unpadded) && unpadded == key;
+        }
+    }
+
+    // Plate codes order as the plates do; sailing codes decode to the ID
+    for (size_t i = 0; i + 1 < sizeof(plates) / sizeof(plates[0]); ++i) {
+        uint64_t lower;
+        uint64_t higher;
+        char decoded[11];
+        ok = ok && strcmp(plates[i], plates[i + 1]) < 0;
+        ok = ok && encodePlate(plates[i], lower) && encodePlate(plates[i + 1], higher) && lower < higher;
+        decodePlate(lower, decoded);
+        ok = ok && strcmp(decoded, plates[i]) == 0;
+    }
+    for (const char* sailingID : sailings) {
+        uint32_t code;
+        char decoded[10];
+        ok = ok && encodeSailingID(sailingID, code) && code != 0;
+        decodeSailingID(code, decoded);
+        ok = ok && strcmp(decoded, sailingID) == 0;
+    }
+
+    // Text with no packed form gives no key
+    ReservationKey refused;
+    ok = ok && !makeReservationKey("AB#1", "VIC-15-08", refused) && !refused.isValid();
+    ok = ok && !makeReservationKey("", "VIC-15-08", refused) && !makeReservationKey("ABCDEFGHIJK", "VIC-15-08", refused);
+    ok = ok && !makeReservationKey("ABC", "VIC-32-08", refused) && !makeReservationKey("ABC", "VIC-15-24", refused);
+    ok = ok && !makeReservationKey("ABC", "V1C-15-08", refused) && !parseReservationID("VIC-15-08", refused);
+    ok = ok && !parseReservationID("NOT AN ID", refused) && !parseReservationID("ABCDEFGHIJKVIC-15-08", refused);
+
+    // A reservation record keeps every field through the codec
+    Reservation original = makeTestReservation("abc-123", "VIC-15-08", 725, Lane::HIGH);
+    original.onboard = true;
+    original.expectedReturnDate = {2026, 10, 16};
+    ReservationRecord packed;
+    ok = ok && ReservationCodec::encode(original, packed) && ReservationCodec::isLive(packed);
+    Reservation decoded = ReservationCodec::decode(packed);
+    ok = ok && strcmp(decoded.id, original.id) == 0 && strcmp(decoded.licensePlate, original.licensePlate) == 0 &&
+         strcmp(decoded.sailingID, original.sailingID) == 0 && decoded.vehicleLength == 725 &&
+         decoded.vehicleHeight == original.vehicleHeight && strcmp(decoded.phone, original.phone) == 0 &&
+         decoded.onboard && decoded.reservedLane == Lane::HIGH && decoded.expectedReturnDate.year == 2026 &&
+         decoded.expectedReturnDate.month == 10 && decoded.expectedReturnDate.day == 16;
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: removeDataFiles
+// Purpose: Deletes every data file startup() reads from the scratch
+//          directory, so the next test starts empty
+static void removeDataFiles() {
+    const char* files[] = {"ferry.format", "ferry.wal", "reservations.dir", "reservations.dat",
+                           "sailings.dat", "sailings.dat.free", "vessels.dat", "vessels.dat.free",
+                           "vehicles.dat", "vehicles.dat.free", "vehicles.idx"};
+    for (const char* file : files) remove(file);
+}
+
+//------------------------------------------------------------------------
+// Function: fileExists
+// Purpose: True if the file can be opened for reading
+static bool fileExists(const string& path) {
+    return ifstream(path).good();
+}
+
+//------------------------------------------------------------------------
+// Function: testPartitionSplit
+// Purpose: Checks that upgrading a single (format 3) reservations.dat
+//          splits its live records into one file per sailing, drops
+//          tombstones and the old file, leaves nothing to do on the next
+//          start, and that dropping one sailing removes only its file
+static bool testPartitionSplit() {
+    removeDataFiles();
+    const char* sailings[] = {"SPA-01-01", "SPB-02-02", "SPC-03-03", "SPD-04-04"};
+    {
+        RecordStore<Reservation, ReservationCodec> single;
+        if (!single.open("reservations.dat")) return false;
+        for (int i = 0; i < 120; ++i) {
+            char plate[11];
+            snprintf(plate, sizeof(plate), "SPL%03d", i);
+            single.append(makeTestReservation(plate, sailings[i % 4], 300 + i, i % 2 ? Lane::HIGH : Lane::LOW));
+        }
+        for (int i = 0; i < 120; ++i) {
+            if (i % 4 == 3 || i % 5 == 0) single.erase(i);  // SPD-04-04 loses every booking
+        }
+    }
+
+    vector<DataFileUpgrade> upgraded;
+    vector<DataFileUpgrade> again;
+    bool ok = upgradeDataFiles(&upgraded) && !upgraded.empty() && upgradeDataFiles(&again) && again.empty();
+    ok = ok && !fileExists("reservations.dat") && fileExists("reservations.dir");
+    ok = ok && fileExists("reservations/SPA-01-01.dat") && fileExists("reservations/SPB-02-02.dat") &&
+         fileExists("reservations/SPC-03-03.dat") && !fileExists("reservations/SPD-04-04.dat");
+
+    // Every live booking is found, with its fields, in its sailing's file
+    initializeReservationStorage();
+    auto checkBookings = [&](int droppedSailing) {
+        bool same = true;
+        for (int i = 0; same && i < 120; ++i) {
+            char plate[11];
+            char id[21];
+            snprintf(plate, sizeof(plate), "SPL%03d", i);
+            makeReservationID(plate, sailings[i % 4], id);
+            optional<Reservation> r = getReservationByID(id);
+            bool live = i % 4 != 3 && i % 5 != 0 && i % 4 != droppedSailing;
+            same = r.has_value() == live;
+            if (same && live) {
+                same = r->vehicleLength == 300 + i && r->reservedLane == (i % 2 ? Lane::HIGH : Lane::LOW);
+            }
+        }
+        return same;
+    };
+    ok = ok && checkBookings(-1) && countReservationsBySailing("SPA-01-01") == 24 &&
+         countReservationsBySailing("SPB-02-02") == 24 && countReservationsBySailing("SPC-03-03") == 24;
+
+    // Dropping a sailing's bookings removes its file and nothing else
+    ok = ok && deleteReservationsBySailingID("SPB-02-02") && !fileExists("reservations/SPB-02-02.dat");
+    shutdownReservationStorage();
+    initializeReservationStorage();
+    ok = ok && checkBookings(1) && fileExists("reservations/SPA-01-01.dat") && fileExists("reservations/SPC-03-03.dat");
+
+    ok = ok && deleteReservationsBySailingID("SPA-01-01") && deleteReservationsBySailingID("SPC-03-03");
+    shutdownReservationStorage();
+    removeDataFiles();
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testRejectedSailingIDs
+// Purpose: Checks that upgrading format 2 data holding a sailing ID the
+//          packed format cannot hold (the old create screen took any
+//          terminal, day and hour) moves that sailing and its bookings to
+//          .rejected files and still converts everything else
+static bool testRejectedSailingIDs() {
+    removeDataFiles();
+    Sailing good = {};
+    strcpy(good.id, "GOD-01-05");
+    strcpy(good.vesselName, "Good Vessel");
+    good.LRL = good.HRL = 10000;
+    Sailing bad = good;
+    strcpy(bad.id, "V1C-45-30");
+    Reservation bookings[] = {makeTestReservation("REJ1", "GOD-01-05", 400, Lane::LOW),
+                              makeTestReservation("REJ2", "V1C-45-30", 400, Lane::LOW)};
+    {
+        ofstream sailings("sailings.dat", ios::binary);
+        sailings.write(reinterpret_cast<const char*>(&bad), sizeof(bad));
+        sailings.write(reinterpret_cast<const char*>(&good), sizeof(good));
+        ofstream reservations("reservations.dat", ios::binary);
+        reservations.write(reinterpret_cast<const char*>(bookings), sizeof(bookings));
+        const uint32_t stamp[] = {0x544D4646, DATA_FORMAT_CENTIMETRES};
+        ofstream("ferry.format", ios::binary).write(reinterpret_cast<const char*>(stamp), sizeof(stamp));
+    }
+
+    vector<DataFileUpgrade> upgraded;
+    bool ok = upgradeDataFiles(&upgraded);
+    uint64_t rejected = 0;
+    for (const DataFileUpgrade& file : upgraded) rejected += file.rejected;
+    ok = ok && rejected == 2;
+    ok = ok && readFileBytes("sailings.dat.rejected").size() == sizeof(Sailing) &&
+         readFileBytes("reservations.dat.rejected").size() == sizeof(Reservation);
+    ok = ok && fileExists("reservations/GOD-01-05.dat") && !fileExists("reservations/V1C-45-30.dat");
+    {
+        RecordStore<Sailing, SailingCodec> store;
+        ok = ok && store.open("sailings.dat") && store.size() == 2 && !store.isLive(0) &&
+             strcmp(store.at(1).id, "GOD-01-05") == 0;  // The rejected slot stays a tombstone
+    }
+
+    remove("sailings.dat.rejected");
+    remove("reservations.dat.rejected");
+    remove("reservations/GOD-01-05.dat");
+    remove("reservations");
+    removeDataFiles();
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: testCheckInDuringCompaction
+// Purpose: Checks that a batch check-in whose lookup ran just before its
+//          sailing's file was compacted still checks every vehicle in: the
+//          handles the compaction invalidated must be looked up again, not
+//          reported as storage failures. The compaction is held behind a
+//          background task until the batch's lookup is done.
+static bool testCheckInDuringCompaction() {
+    removeDataFiles();
+    startup();
+
+    // As many cancelled bookings as live ones, so the file needs compacting
+    bool ok = true;
+    vector<string> plates;
+    for (int i = 0; ok && i < 1000; ++i) {
+        char plate[11];
+        snprintf(plate, sizeof(plate), "CMP%04d", i);
+        plates.push_back(plate);
+        snprintf(plate, sizeof(plate), "GONE%04d", i);
+        ok = addReservation(makeTestReservation(plates.back().c_str(), "CMP-08-14", 400, Lane::LOW)) &&
+             addReservation(makeTestReservation(plate, "CMP-08-14", 400, Lane::LOW));
+    }
+    atomic<bool> lookedUp(false);
+    scheduleBackgroundTask("testFileOps hold", [&lookedUp]() {
+        while (!lookedUp) this_thread::sleep_for(chrono::milliseconds(1));
+    });
+    for (int i = 0; ok && i < 1000; ++i) {
+        char plate[11];
+        char id[21];
+        snprintf(plate, sizeof(plate), "GONE%04d", i);
+        makeReservationID(plate, "CMP-08-14", id);
+        ok = deleteReservation(string(id));
+    }
+
+    // The batch resolves every plate through the Bloom filter first; once
+    // it has, let the queued compaction run under the check-in loop
+    uint64_t queries = getReservationFilterStats().queries;
+    vector<BatchCheckInResult> results;
+    thread batch([&]() {
+        vector<const char*> queue;
+        for (const string& plate : plates) queue.push_back(plate.c_str());
+        ReservationService::checkInBatch("CMP-08-14", queue.data(), queue.size(), results);
+    });
+    while (getReservationFilterStats().queries < queries + plates.size()) this_thread::yield();
+    lookedUp = true;
+    batch.join();
+    stopBackgroundTasks();
+
+    ok = ok && results.size() == plates.size();
+    for (const BatchCheckInResult& result : results) {
+        ok = ok && result.status == static_cast<uint16_t>(FerryStatus::OK);
+    }
+    ok = ok && countReservationsBySailing("CMP-08-14") == 1000;
+    for (const string& plate : plates) {
+        char id[21];
+        makeReservationID(plate.c_str(), "CMP-08-14", id);
+        ok = ok && getOnboardStatus(id);
+    }
+
+    shutdown();
+    removeDataFiles();
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// Function: countOnboardInFile
+// Purpose: Counts the records of a reservation file flagged onboard, as the
+//          file itself holds them (pending in-memory changes not included)
+static int countOnboardInFile(const char* path) {
+    vector<char> bytes = readFileBytes(path);
+    int onboard = 0;
+    for (size_t offset = RECORD_FILE_HEADER_BYTES; offset + sizeof(ReservationRecord) <= bytes.size();
+         offset += sizeof(ReservationRecord)) {
+        if (bytes[offset + offsetof(ReservationRecord, flags)] & RESERVATION_ONBOARD) ++onboard;
+    }
+    return onboard;
+}
+
+//------------------------------------------------------------------------
+// Function: testPreparedSailingWriteBack
+// Purpose: Checks that check-ins on a prepared sailing are seen at once by
+//          lookups, reach the sailing's file a full batch at a time, and
+//          that the rest are written to the file when the sailing departs
+static bool testPreparedSailingWriteBack() {
+    remove("reservations.dir");
+    initializeReservationStorage();
+
+    bool ok = true;
+    vector<string> ids;
+    for (int i = 0; ok && i < 100; ++i) {
+        char plate[11];
+        snprintf(plate, sizeof(plate), "PRE%03d", i);
+        Reservation r = makeTestReservation(plate, "PRE-09-15", 400, Lane::LOW);
+        ids.push_back(r.id);
+        ok = addReservation(r);
+    }
+    ok = ok && prepareSailingCheckIn("PRE-09-15") == 100;
+
+    // 70 check-ins: one full batch of 64 is written back, 6 stay pending
+    for (int i = 0; ok && i < 70; ++i) ok = setOnboardStatus(ids[i], true);
+    ok = ok && getOnboardStatus(ids[69]) && !getOnboardStatus(ids[70]);
+    ok = ok && countOnboardInFile("reservations/PRE-09-15.dat") == 64;
+
+    // Departure writes the pending ones to the file and drops the table
+    releaseSailingCheckIn("PRE-09-15");
+    ok = ok && countOnboardInFile("reservations/PRE-09-15.dat") == 70;
+    for (int i = 0; ok && i < 100; ++i) ok = getOnboardStatus(ids[i]) == (i < 70);
+
+    // A sailing prepared again starts from what the file holds
+    ok = ok && prepareSailingCheckIn("PRE-09-15") == 100 && getOnboardStatus(ids[0]) && !getOnboardStatus(ids[99]);
+    releaseSailingCheckIn("PRE-09-15");
+
+    ok = ok && deleteReservationsBySailingID("PRE-09-15");
+    shutdownReservationStorage();
+    remove("reservations.dir");
+    return ok;
+}
+
+//------------------------------------------------------------------------
+// The tests run here, never in the clerk's working directory
+static char scratchDirectory[] = "/tmp/testFileOpsXXXXXX";
+
+//------------------------------------------------------------------------
+// Function: removeScratchDirectory
+// Purpose: Deletes the scratch directory and every file the tests left in it
+static void removeScratchDirectory() {
+    if (chdir("/") != 0 || system((string("rm -rf ") + scratchDirectory).c_str()) != 0) {
+        cerr << "Could not remove " << scratchDirectory << endl;
+    }
+}
+
 //------------------------------------------------------------------------
 int main() {
-    // Clear the reservations.dat file before starting the test
-    ofstream wipe("reservations.dat", ios::binary | ios::trunc);
-    wipe.close();
+    // Fresh storage, away from the clerk's data files; removed at exit
+    if (!mkdtemp(scratchDirectory) || chdir(scratchDirectory) != 0) {
+        perror("scratch directory");
+        return 1;
+    }
+    atexit(removeScratchDirectory);
 
     // Initialize the reservation storage
     initializeReservationStorage();
@@ -50,8 +963,8 @@ int main() {
         "",               // id (will be populated later)
         "TEST123",        // licensePlate
         "VIC-15-08",      // sailingID
-        4.5f,             // vehicleLength
-        2.1f,             // vehicleHeight
+        450,              // vehicleLength (cm)
+        210,              // vehicleHeight (cm)
         "604-123-4567",   // phone
         false,            // onboard
         {2025, 7, 25},    // expectedReturnDate
@@ -65,8 +978,8 @@ int main() {
         "",               // id
         "ABC789",         // licensePlate
         "VIC-16-08",      // sailingID
-        5.0f,             // vehicleLength
-        2.2f,             // vehicleHeight
+        500,              // vehicleLength (cm)
+        220,              // vehicleHeight (cm)
         "778-555-0000",   // phone
         true,             // onboard
         {2025, 7, 30},    // expectedReturnDate
@@ -80,8 +993,8 @@ int main() {
         "",               // id
         "TYBEAST",        // licensePlate
         "VIC-16-02",      // sailingID
-        3.0f,             // vehicleLength
-        1.2f,             // vehicleHeight
+        300,              // vehicleLength (cm)
+        120,              // vehicleHeight (cm)
         "604-808-8008",   // phone
         true,             // onboard
         {2025, 6, 25},    // expectedReturnDate
@@ -105,7 +1018,8 @@ int main() {
     auto res1 = getReservationByID(r1.id);
     auto res2 = getReservationByID(r2.id);
     auto res3 = getReservationByID(r3.id);
-    auto notFound = getReservationByID("NOTREAL");
+    auto notFound = getReservationByID("NOTREAL");            // not a plate + sailing ID
+    auto keyNotFound = getReservationByID("NOTREALVIC-15-08");  // well-formed, never booked
 
     // Verify and print results
     if (res1) {
@@ -129,13 +1043,97 @@ int main() {
         cout << "FAIL: TYBEAST not found." << endl;
     }
 
-    if (!notFound) {
+    if (!notFound && !keyNotFound) {
         cout << "PASS: NOTREAL correctly not found (EOF test)." << endl;
     } else {
         cout << "FAIL: NOTREAL should not exist." << endl;
     }
 
+    // Every lookup of a well-formed ID went through the Bloom filter; the
+    // missing one is either ruled out by it or counted as a false positive
+    BloomFilterStats filterStats = getReservationFilterStats();
+    if (filterStats.queries >= 4 && filterStats.definiteAbsent + filterStats.falsePositives >= 1) {
+        cout << "PASS: Bloom filter counted " << filterStats.queries << " lookups, "
+             << filterStats.definiteAbsent << " definitely absent." << endl;
+    } else {
+        cout << "FAIL: Bloom filter counters not updated." << endl;
+    }
+
     // Shutdown the reservation storage
     shutdownReservationStorage();
+
+    if (testRejectedFilesUnchanged()) {
+        cout << "PASS: Rejected record files left unchanged." << endl;
+    }
+    if (testDuplicateSailingDelete()) {
+        cout << "PASS: Duplicate sailing survives deleting its twin." << endl;
+    } else {
+        cout << "FAIL: Duplicate sailing lost its index or capacity." << endl;
+    }
+    if (testSailingPages()) {
+        cout << "PASS: Sailing pages come newest first, without deleted sailings." << endl;
+    } else {
+        cout << "FAIL: A sailing page was out of order or held a deleted sailing." << endl;
+    }
+    if (testBlockScan()) {
+        cout << "PASS: Block scan visits every live record once, in order." << endl;
+    } else {
+        cout << "FAIL: Block scan missed, repeated or reordered records." << endl;
+    }
+    if (testFixedStringMatch()) {
+        cout << "PASS: FixedString keys match as strncmp does." << endl;
+    } else {
+        cout << "FAIL: FixedString keys disagree with strncmp." << endl;
+    }
+    if (testSailingAggregates()) {
+        cout << "PASS: Sailing aggregates follow every reservation change." << endl;
+    } else {
+        cout << "FAIL: Sailing aggregates out of step with the reservations." << endl;
+    }
+    if (testRecordHandles()) {
+        cout << "PASS: Record handles resolve until their record is deleted or moved." << endl;
+    } else {
+        cout << "FAIL: A record handle resolved to the wrong record or not at all." << endl;
+    }
+    if (testBatchLookup()) {
+        cout << "PASS: Batch lookups answer every key as single lookups do." << endl;
+    } else {
+        cout << "FAIL: A batch lookup answer differs from a single lookup." << endl;
+    }
+    if (testConcurrentReaders()) {
+        cout << "PASS: Concurrent lookups and changes lost no reservations." << endl;
+    } else {
+        cout << "FAIL: Concurrent lookups or changes lost reservations." << endl;
+    }
+    if (testContendedCapacity()) {
+        cout << "PASS: Contended bookings never oversold a sailing." << endl;
+    } else {
+        cout << "FAIL: Contended bookings oversold or lost lane space." << endl;
+    }
+    if (testPackedKeys()) {
+        cout << "PASS: Packed reservation keys round-trip and keep their order." << endl;
+    } else {
+        cout << "FAIL: A packed reservation key changed or misordered its ID." << endl;
+    }
+    if (testPartitionSplit()) {
+        cout << "PASS: Upgrade splits reservations.dat into one file per sailing." << endl;
+    } else {
+        cout << "FAIL: Upgrade lost or misplaced reservations splitting by sailing." << endl;
+    }
+    if (testRejectedSailingIDs()) {
+        cout << "PASS: Upgrade sets aside sailing IDs the packed format cannot hold." << endl;
+    } else {
+        cout << "FAIL: Upgrade failed or lost records over an unpackable sailing ID." << endl;
+    }
+    if (testCheckInDuringCompaction()) {
+        cout << "PASS: Batch check-in succeeds across a compaction of its file." << endl;
+    } else {
+        cout << "FAIL: Batch check-in failed after its file was compacted." << endl;
+    }
+    if (testPreparedSailingWriteBack()) {
+        cout << "PASS: Prepared sailing check-ins reach the file by departure." << endl;
+    } else {
+        cout << "FAIL: Prepared sailing check-ins missing from the file after departure." << endl;
+    }
     return 0;
 }
\ No newline at end of file
@@ -34,12 +34,20 @@ std::tm g_localTime; // global variable for local time
 // Add prototype for viewSailingReport
 void viewSailingReport();
 
-void testOneSailing() {
+// Empties sailings.dat. Storage is shut down first because the ASMs keep
+// their data files memory-mapped while running.
+void clearSailingFile() {
+    shutdown();
     std::ofstream New("sailings.dat", std::ios::binary | std::ios::trunc);
     New.close();
+    startup();
+}
+
+void testOneSailing() {
+    clearSailingFile();
 
     vector<Sailing> single = {
-        Sailing{"XXX-DD-HH", "CCCCcCCCCc", 1000.0f, 1000.0f}
+        Sailing{"XXX-15-08", "CCCCcCCCCc", 100000, 100000}
     };
 
     // Add sailing to storage
@@ -74,7 +82,7 @@ void testOneSailing() {
     "-------------------------------------------------------------------------------\n"
     " #   Vessel Name                Sailing ID      LRL(m)     HRL(m)    TV     CF\n"
     "-------------------------------------------------------------------------------\n"
-    " 1)  CCCCcCCCCc                 XXX-DD-HH       1000.0     1000.0     0    0.0%\n"
+    " 1)  CCCCcCCCCc                 XXX-15-08       1000.0     1000.0     0    0.0%\n"
     "-------------------------------------------------------------------------------\n";
 
 
@@ -91,8 +99,7 @@ void testOneSailing() {
 
 void testZeroSailings() {
 
-    std::ofstream New("sailings.dat", std::ios::binary | std::ios::trunc);
-    New.close();
+    clearSailingFile();
 
     // Capture output
     ostringstream out;
@@ -128,18 +135,17 @@ void testZeroSailings() {
 
 void testSevenSailings() {
     // Clear sailings file before test
-    std::ofstream New("sailings.dat", std::ios::binary | std::ios::trunc);
-    New.close();
+    clearSailingFile();
 
     // Same data for ease of testing
     vector<Sailing> seven = {
-        Sailing{"XXX-DD-HH", "CCCCcCCCCc", 1000.0f, 1000.0f},
-        Sailing{"XXX-DD-HH", "CCCCcCCCCc", 1000.0f, 1000.0f},
-        Sailing{"XXX-DD-HH", "CCCCcCCCCc", 1000.0f, 1000.0f},
-        Sailing{"XXX-DD-HH", "CCCCcCCCCc", 1000.0f, 1000.0f},
-        Sailing{"XXX-DD-HH", "CCCCcCCCCc", 1000.0f, 1000.0f},
-        Sailing{"XXX-DD-HH", "CCCCcCCCCc", 1000.0f, 1000.0f},
-        Sailing{"XXX-DD-HH", "CCCCcCCCCc", 1000.0f, 1000.0f}
+        Sailing{"XXX-15-08", "CCCCcCCCCc", 100000, 100000},
+        Sailing{"XXX-15-08", "CCCCcCCCCc", 100000, 100000},
+        Sailing{"XXX-15-08", "CCCCcCCCCc", 100000, 100000},
+        Sailing{"XXX-15-08", "CCCCcCCCCc", 100000, 100000},
+        Sailing{"XXX-15-08", "CCCCcCCCCc", 100000, 100000},
+        Sailing{"XXX-15-08", "CCCCcCCCCc", 100000, 100000},
+        Sailing{"XXX-15-08", "CCCCcCCCCc", 100000, 100000}
     };
     for (const auto& s : seven) addSailing(s);
 
@@ -166,11 +172,11 @@ void testSevenSailings() {
         "-------------------------------------------------------------------------------\n"
         " #   Vessel Name                Sailing ID      LRL(m)     HRL(m)    TV     CF\n"
         "-------------------------------------------------------------------------------\n"
-        " 1)  CCCCcCCCCc                 XXX-DD-HH       1000.0     1000.0     0    0.0%\n"
-        " 2)  CCCCcCCCCc                 XXX-DD-HH       1000.0     1000.0     0    0.0%\n"
-        " 3)  CCCCcCCCCc                 XXX-DD-HH       1000.0     1000.0     0    0.0%\n"
-        " 4)  CCCCcCCCCc                 XXX-DD-HH       1000.0     1000.0     0    0.0%\n"
-        " 5)  CCCCcCCCCc                 XXX-DD-HH       1000.0     1000.0     0    0.0%\n"
+        " 1)  CCCCcCCCCc                 XXX-15-08       1000.0     1000.0     0    0.0%\n"
+        " 2)  CCCCcCCCCc                 XXX-15-08       1000.0     1000.0     0    0.0%\n"
+        " 3)  CCCCcCCCCc                 XXX-15-08       1000.0     1000.0     0    0.0%\n"
+        " 4)  CCCCcCCCCc                 XXX-15-08       1000.0     1000.0     0    0.0%\n"
+        " 5)  CCCCcCCCCc                 XXX-15-08       1000.0     1000.0     0    0.0%\n"
         "-------------------------------------------------------------------------------\n"
         "Load More? [y/n]: \n"
         "[VIEW SAILING REPORT]\n"
@@ -179,8 +185,8 @@ void testSevenSailings() {
         "-------------------------------------------------------------------------------\n"
         " #   Vessel Name                Sailing ID      LRL(m)     HRL(m)    TV     CF\n"
         "-------------------------------------------------------------------------------\n"
-        " 6)  CCCCcCCCCc                 XXX-DD-HH       1000.0     1000.0     0    0.0%\n"
-        " 7)  CCCCcCCCCc                 XXX-DD-HH       1000.0     1000.0     0    0.0%\n"
+        " 6)  CCCCcCCCCc                 XXX-15-08       1000.0     1000.0     0    0.0%\n"
+        " 7)  CCCCcCCCCc                 XXX-15-08       1000.0     1000.0     0    0.0%\n"
         "-------------------------------------------------------------------------------\n";
 
     if (out.str() == expected) {